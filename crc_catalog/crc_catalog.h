@@ -8,10 +8,91 @@
 #ifndef CRC_CATALOG_2018_10_13_H_
   #define CRC_CATALOG_2018_10_13_H_
 
+  #include <array>
   #include <cstddef>
   #include <cstdint>
   #include <limits>
+  #include <tuple>
   #include <type_traits>
+  #include <utility>
+
+  // The default number of slices (lookup tables) used by the slicing
+  // engine of the named CRCs having more than 8 bits. This can be set
+  // to a smaller value in order to reduce the memory footprint of the
+  // tables, or to 16 for slicing-by-16.
+  #if !defined(CRC_CATALOG_SLICE_COUNT)
+  #define CRC_CATALOG_SLICE_COUNT 8U
+  #endif
+
+  // The named CRCs and the default engine can be used in constant expressions
+  // if constant evaluation can be detected (via std::is_constant_evaluated or
+  // the corresponding compiler builtin). They use the portable table-driven
+  // engines during constant evaluation and the accelerated engines at runtime.
+  #if defined(__cpp_lib_is_constant_evaluated)
+    #define CRC_CATALOG_HAS_CONSTANT_EVALUATED
+    #define CRC_CATALOG_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+  #elif defined(__has_builtin)
+    #if __has_builtin(__builtin_is_constant_evaluated)
+    #define CRC_CATALOG_HAS_CONSTANT_EVALUATED
+    #define CRC_CATALOG_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+    #endif
+  #elif (defined(__GNUC__) && (__GNUC__ >= 9)) || (defined(_MSC_VER) && (_MSC_VER >= 1925))
+    #define CRC_CATALOG_HAS_CONSTANT_EVALUATED
+    #define CRC_CATALOG_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+  #endif
+
+  #if defined(CRC_CATALOG_HAS_CONSTANT_EVALUATED)
+  #define CRC_CATALOG_CONSTEXPR constexpr
+  #else
+  #define CRC_CATALOG_CONSTEXPR
+  #define CRC_CATALOG_IS_CONSTANT_EVALUATED() false
+  #endif
+
+  // The carry-less multiplication folding engine is available on x86-64.
+  // It is selected at runtime if the CPU supports PCLMULQDQ and SSSE3.
+  // Define CRC_CATALOG_DISABLE_CLMUL in order to use portable code only.
+  #if !defined(CRC_CATALOG_DISABLE_CLMUL) && (defined(__x86_64__) || defined(_M_X64))
+  #define CRC_CATALOG_HAS_CLMUL
+  #endif
+
+  // The CRC-32C instruction path of crc_crc32_c is available on x86-64
+  // (SSE4.2) and on AArch64 targets having the ARMv8 CRC32 extension.
+  // It is selected at runtime if the CPU supports the instructions.
+  // Define CRC_CATALOG_DISABLE_CRC32C in order to use the generic engines.
+  #if !defined(CRC_CATALOG_DISABLE_CRC32C)
+    #if defined(__x86_64__) || defined(_M_X64)
+    #define CRC_CATALOG_HAS_CRC32C
+    #define CRC_CATALOG_HAS_CRC32C_SSE42
+    #elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+    #define CRC_CATALOG_HAS_CRC32C
+    #define CRC_CATALOG_HAS_CRC32C_ARMV8
+    #endif
+  #endif
+
+  #if defined(CRC_CATALOG_HAS_CLMUL) || defined(CRC_CATALOG_HAS_CRC32C_SSE42)
+    #if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+    #define CRC_CATALOG_TARGET_CLMUL
+    #define CRC_CATALOG_TARGET_SSE42
+    #else
+    #include <cpuid.h>
+    #include <immintrin.h>
+    #define CRC_CATALOG_TARGET_CLMUL __attribute__((target("pclmul,ssse3")))
+    #define CRC_CATALOG_TARGET_SSE42 __attribute__((target("sse4.2")))
+    #endif
+  #endif
+
+  #if defined(CRC_CATALOG_HAS_CRC32C_ARMV8)
+    #include <arm_acle.h>
+    #if defined(__linux__)
+    #include <sys/auxv.h>
+    #endif
+  #endif
+
+  // Counters and histograms of the computations, see crc_catalog_stats.h.
+  #if defined(CRC_CATALOG_ENABLE_STATS)
+  #include <crc_catalog_stats.h>
+  #endif
 
   namespace crc { namespace catalog {
 
@@ -60,9 +141,12 @@
     using exact_unsigned_type = std::uint64_t;
   };
 
+  template<const std::size_t NumberOfBits>
+  using crc_value_type = typename uint_type_helper<NumberOfBits>::exact_unsigned_type;
+
   template<const std::size_t NumberOfBits,
            typename UnsignedIntegralType = typename detail::uint_type_helper<NumberOfBits>::exact_unsigned_type>
-  UnsignedIntegralType crc_reflect_template(UnsignedIntegralType data)
+  constexpr UnsignedIntegralType crc_reflect_template(UnsignedIntegralType data)
   {
     using value_type = UnsignedIntegralType;
 
@@ -82,189 +166,2760 @@
     return reflected_result;
   }
 
-  } // namespace crc::catalog::detail
+  // The table-driven engine keeps the CRC register of a non-reflected
+  // algorithm left-justified within value_type. The register of a reflected
+  // algorithm is kept reflected and right-justified, so that the input
+  // bytes can be used as they are, without per-byte reflection.
+
+  template<typename UnsignedIntegralType>
+  struct crc_table_array
+  {
+    UnsignedIntegralType values[256U];
+  };
+
+  // The table entry of a byte, or of a nibble for bit_count = 4.
 
   template<const std::size_t NumberOfBits,
-           typename UnsignedIntegralType = typename detail::uint_type_helper<NumberOfBits>::exact_unsigned_type>
-  UnsignedIntegralType crc_bitwise_template(const std::uint8_t*         message,
-                                            const std::size_t           count,
-                                            const UnsignedIntegralType& polynomial,
-                                            const UnsignedIntegralType& initial_value,
-                                            const UnsignedIntegralType& final_xor_value,
-                                            const bool                  reflect_in,
-                                            const bool                  reflect_out)
+           typename UnsignedIntegralType,
+           const bool ReflectIn>
+  constexpr UnsignedIntegralType crc_table_entry(const std::uint8_t         byte_value,
+                                                 const UnsignedIntegralType& polynomial,
+                                                 const std::size_t           bit_count = 8U)
   {
     using value_type = UnsignedIntegralType;
 
-    // The data_type is fixed to exactly 8-bits in width at the moment.
-    using data_type = std::uint8_t;
-
-    static_assert(std::numeric_limits<std::uint8_t>::digits == 8,
-                  "Error: The data_type (at the moment) must have exactly 8 bits.");
+    const std::size_t left_shift_amount =
+      std::size_t(std::size_t(std::numeric_limits<value_type>::digits) - NumberOfBits);
 
     value_type crc =
-      initial_value << (std::size_t(std::numeric_limits<value_type>::digits) - NumberOfBits);
+      ((ReflectIn == false)
+        ? value_type(value_type(byte_value) << (std::size_t(std::numeric_limits<value_type>::digits) - bit_count))
+        : value_type(byte_value));
 
-    // Perform the polynomial division, one element at a time.
-    for(std::size_t data_index = 0U; data_index < count; ++data_index)
+    for(std::size_t bit_index = 0U; bit_index < bit_count; ++bit_index)
     {
-      // Obtain the next data element (and reflect it if necessary).
-      const data_type next_data_element =
-        ((reflect_in == false)
-          ? message[data_index]
-          : detail::crc_reflect_template<std::size_t(std::numeric_limits<data_type>::digits)>(message[data_index]));
+      if(ReflectIn == false)
+      {
+        const bool high_bit_of_crc_is_set =
+          (value_type(crc & value_type(std::uintmax_t(1ULL) << (std::numeric_limits<value_type>::digits - 1))) != 0U);
 
+        crc = value_type(crc << 1);
+
+        if(high_bit_of_crc_is_set)
+        {
+          crc ^= value_type(polynomial << left_shift_amount);
+        }
+      }
+      else
       {
-        const std::size_t left_shift_amount =
-          std::size_t(  std::numeric_limits<value_type>::digits
-                      - std::numeric_limits<data_type >::digits);
+        const bool low_bit_of_crc_is_set = (value_type(crc & 1U) != 0U);
 
-        crc ^= value_type(value_type(next_data_element) << left_shift_amount);
+        crc = value_type(crc >> 1);
+
+        if(low_bit_of_crc_is_set)
+        {
+          crc ^= crc_reflect_template<NumberOfBits, value_type>(polynomial);
+        }
       }
+    }
 
-      // Process the next data byte, one bit at a time.
-      for(std::uint_fast8_t bit_index = 0U; bit_index < std::uint_fast8_t(std::numeric_limits<data_type>::digits); ++bit_index)
+    return crc;
+  }
+
+  template<const std::size_t NumberOfBits,
+           typename UnsignedIntegralType,
+           const bool ReflectIn>
+  constexpr crc_table_array<UnsignedIntegralType> crc_table_make(const UnsignedIntegralType& polynomial)
+  {
+    crc_table_array<UnsignedIntegralType> table { };
+
+    for(std::size_t i = 0U; i < 256U; ++i)
+    {
+      table.values[i] = crc_table_entry<NumberOfBits, UnsignedIntegralType, ReflectIn>(std::uint8_t(i), polynomial);
+    }
+
+    return table;
+  }
+
+  template<const std::size_t NumberOfBits,
+           const crc_value_type<NumberOfBits> Polynomial,
+           const bool ReflectIn>
+  struct crc_table
+  {
+    using value_type = crc_value_type<NumberOfBits>;
+    using table_type = crc_table_array<value_type>;
+
+    static constexpr table_type table = crc_table_make<NumberOfBits, value_type, ReflectIn>(Polynomial);
+
+    // The memory of the lookup tables used by the engine.
+    static constexpr std::size_t table_size() { return sizeof(table_type); }
+
+    // The message bytes can also be of type char, for use
+    // with string literals in constant expressions.
+    template<typename ByteType>
+    static constexpr value_type update(value_type crc, const ByteType* message, const std::size_t count)
+    {
+      static_assert(sizeof(ByteType) == 1U, "Error: The message must consist of bytes.");
+
+      const ByteType* message_end = message + count;
+
+      while(message != message_end)
       {
-        const bool high_bit_of_crc_is_set =
-          (value_type(crc & value_type(std::uintmax_t(1ULL) << (std::numeric_limits<value_type>::digits - 1))) != 0U);
+        if(ReflectIn == false)
+        {
+          const std::uint8_t table_index =
+            std::uint8_t(std::uint8_t(crc >> (std::numeric_limits<value_type>::digits - 8)) ^ std::uint8_t(*message));
 
-        crc <<= 1;
+          crc = value_type(value_type(crc << 8) ^ table.values[table_index]);
+        }
+        else
+        {
+          const std::uint8_t table_index = std::uint8_t(std::uint8_t(crc) ^ std::uint8_t(*message));
 
-        if(high_bit_of_crc_is_set)
+          crc = value_type(value_type(crc >> 8) ^ table.values[table_index]);
+        }
+
+        ++message;
+      }
+
+      return crc;
+    }
+  };
+
+  template<const std::size_t NumberOfBits,
+           const crc_value_type<NumberOfBits> Polynomial,
+           const bool ReflectIn>
+  constexpr typename crc_table<NumberOfBits, Polynomial, ReflectIn>::table_type crc_table<NumberOfBits, Polynomial, ReflectIn>::table;
+
+  // The nibble engines are table-driven engines with small tables for
+  // processes using many algorithms at once, where the 256-entry tables
+  // of all of them would not fit in the caches. crc_nibble_table processes
+  // a byte in two steps of 4 bits with one 16-entry table. crc_nibble_pair
+  // processes a byte in one step, looking up its two nibbles independently
+  // in a pair of 16-entry tables (the entries of the 256-entry table for
+  // the bytes 0x00 to 0x0F and 0x00 to 0xF0), whose sum is the 256-entry
+  // table entry of the byte. Both use the register layout described above.
+
+  template<typename UnsignedIntegralType,
+           const std::size_t TableCount>
+  struct crc_nibble_array
+  {
+    UnsignedIntegralType values[TableCount][16U];
+  };
+
+  template<const std::size_t NumberOfBits,
+           typename UnsignedIntegralType,
+           const bool ReflectIn,
+           const std::size_t TableCount>
+  constexpr crc_nibble_array<UnsignedIntegralType, TableCount> crc_nibble_make(const UnsignedIntegralType& polynomial)
+  {
+    crc_nibble_array<UnsignedIntegralType, TableCount> tables { };
+
+    for(std::size_t i = 0U; i < 16U; ++i)
+    {
+      if(TableCount == 1U)
+      {
+        tables.values[0U][i] = crc_table_entry<NumberOfBits, UnsignedIntegralType, ReflectIn>(std::uint8_t(i), polynomial, 4U);
+      }
+      else
+      {
+        tables.values[0U][i] = crc_table_entry<NumberOfBits, UnsignedIntegralType, ReflectIn>(std::uint8_t(i), polynomial);
+
+        tables.values[TableCount - 1U][i] = crc_table_entry<NumberOfBits, UnsignedIntegralType, ReflectIn>(std::uint8_t(i << 4U), polynomial);
+      }
+    }
+
+    return tables;
+  }
+
+  template<const std::size_t NumberOfBits,
+           const crc_value_type<NumberOfBits> Polynomial,
+           const bool ReflectIn>
+  struct crc_nibble_table
+  {
+    using value_type = crc_value_type<NumberOfBits>;
+    using table_type = crc_nibble_array<value_type, 1U>;
+
+    static constexpr table_type table = crc_nibble_make<NumberOfBits, value_type, ReflectIn, 1U>(Polynomial);
+
+    static constexpr std::size_t table_size() { return sizeof(table_type); }
+
+    static constexpr value_type update(value_type crc, const std::uint8_t* message, const std::size_t count)
+    {
+      for(std::size_t index = 0U; index < count; ++index)
+      {
+        if(ReflectIn == false)
         {
-          // Shift through the polynomial. Also left-justify the
-          // polynomial within the width of value_type, if necessary.
-          const std::size_t left_shift_amount =
-            std::size_t(std::size_t(std::numeric_limits<value_type>::digits) - NumberOfBits);
+          crc ^= value_type(value_type(message[index]) << (digits - 8));
 
-          crc ^= value_type(polynomial << left_shift_amount);
+          crc = value_type(value_type(crc << 4) ^ table.values[0U][std::uint8_t(crc >> (digits - 4))]);
+          crc = value_type(value_type(crc << 4) ^ table.values[0U][std::uint8_t(crc >> (digits - 4))]);
+        }
+        else
+        {
+          crc ^= value_type(message[index]);
+
+          crc = value_type(value_type(crc >> 4) ^ table.values[0U][std::uint8_t(crc & 0x0FU)]);
+          crc = value_type(value_type(crc >> 4) ^ table.values[0U][std::uint8_t(crc & 0x0FU)]);
         }
       }
+
+      return crc;
     }
 
-    // Downshift the result to compensate for a potential
-    // left-justification of the polynomial in the loop above.
+  private:
+    static constexpr int digits = std::numeric_limits<value_type>::digits;
+  };
+
+  template<const std::size_t NumberOfBits,
+           const crc_value_type<NumberOfBits> Polynomial,
+           const bool ReflectIn>
+  constexpr typename crc_nibble_table<NumberOfBits, Polynomial, ReflectIn>::table_type crc_nibble_table<NumberOfBits, Polynomial, ReflectIn>::table;
+
+  template<const std::size_t NumberOfBits,
+           const crc_value_type<NumberOfBits> Polynomial,
+           const bool ReflectIn>
+  struct crc_nibble_pair
+  {
+    using value_type = crc_value_type<NumberOfBits>;
+    using table_type = crc_nibble_array<value_type, 2U>;
+
+    static constexpr table_type table = crc_nibble_make<NumberOfBits, value_type, ReflectIn, 2U>(Polynomial);
+
+    static constexpr std::size_t table_size() { return sizeof(table_type); }
+
+    static constexpr value_type update(value_type crc, const std::uint8_t* message, const std::size_t count)
     {
+      for(std::size_t index = 0U; index < count; ++index)
+      {
+        const std::uint8_t table_index =
+          std::uint8_t(((ReflectIn == false) ? std::uint8_t(crc >> (digits - 8)) : std::uint8_t(crc)) ^ message[index]);
+
+        const value_type shifted_crc =
+          ((ReflectIn == false) ? value_type(crc << 8) : value_type(crc >> 8));
+
+        crc = value_type(shifted_crc ^ table.values[0U][table_index & 0x0FU] ^ table.values[1U][table_index >> 4U]);
+      }
+
+      return crc;
+    }
+
+  private:
+    static constexpr int digits = std::numeric_limits<value_type>::digits;
+  };
+
+  template<const std::size_t NumberOfBits,
+           const crc_value_type<NumberOfBits> Polynomial,
+           const bool ReflectIn>
+  constexpr typename crc_nibble_pair<NumberOfBits, Polynomial, ReflectIn>::table_type crc_nibble_pair<NumberOfBits, Polynomial, ReflectIn>::table;
+
+  // The bitwise engine processes one bit at a time without a lookup table.
+  // It uses the register layout of the table-driven engine. Since the
+  // width, polynomial and reflection are template parameters, the
+  // polynomial is selected with a mask rather than with a branch.
+
+  template<const std::size_t NumberOfBits,
+           const crc_value_type<NumberOfBits> Polynomial,
+           const bool ReflectIn>
+  struct crc_bitwise
+  {
+    using value_type = crc_value_type<NumberOfBits>;
+
+    static constexpr std::size_t table_size() { return 0U; }
+
+    template<typename ByteType>
+    static constexpr value_type update(value_type crc, const ByteType* message, const std::size_t count)
+    {
+      static_assert(sizeof(ByteType) == 1U, "Error: The message must consist of bytes.");
+
+      for(std::size_t index = 0U; index < count; ++index)
+      {
+        crc = step(crc, std::uint8_t(message[index]));
+      }
+
+      return crc;
+    }
+
+    // Process the first bit_count (0 to 8) bits of a byte. These are the
+    // most significant bits without input reflection and the least
+    // significant bits with input reflection (the order in which the
+    // bits of whole bytes are processed).
+    static constexpr value_type update_bits(const value_type crc, const std::uint8_t byte_value, const std::size_t bit_count)
+    {
+      const std::uint8_t bit_mask =
+        ((ReflectIn == false) ? std::uint8_t(0xFFU << (8U - bit_count)) : std::uint8_t(0xFFU >> (8U - bit_count)));
+
+      return step(crc, std::uint8_t(byte_value & bit_mask), bit_count);
+    }
+
+  private:
+    static constexpr int digits = std::numeric_limits<value_type>::digits;
+
+    static constexpr value_type step(value_type crc, const std::uint8_t byte_value, const std::size_t bit_count = 8U)
+    {
+      // The polynomial in the orientation of the register.
+      const value_type register_polynomial =
+        ((ReflectIn == false) ? value_type(Polynomial << (digits - int(NumberOfBits)))
+                              : crc_reflect_template<NumberOfBits, value_type>(Polynomial));
+
+      crc ^= ((ReflectIn == false) ? value_type(value_type(byte_value) << (digits - 8)) : value_type(byte_value));
+
+      for(std::size_t bit_index = 0U; bit_index < bit_count; ++bit_index)
+      {
+        const value_type feedback_bit =
+          ((ReflectIn == false) ? value_type(crc >> (digits - 1)) : value_type(crc & 1U));
+
+        const value_type shifted_crc =
+          ((ReflectIn == false) ? value_type(crc << 1) : value_type(crc >> 1));
+
+        crc = value_type(shifted_crc ^ value_type(register_polynomial & value_type(value_type(0U) - feedback_bit)));
+      }
+
+      return crc;
+    }
+  };
+
+  // The slicing-by-N engine processes SliceCount bytes per step using SliceCount
+  // lookup tables. The table of slice k holds the contribution of the byte b
+  // followed by k zero bytes, so that all lookups of a step are independent.
+  // The register layout is the same as the one of the table-driven engine.
+  //
+  // The table of slice 0 is the 256-entry table of crc_table, so the slicing
+  // engine stores only the tables of the slices 1 to N-1. Like all of the
+  // tables here, they depend on the width, polynomial and reflection alone
+  // and are therefore shared by all algorithms that differ only in their
+  // initial value, final XOR value or output reflection (for instance
+  // CRC-16/CCITT-FALSE, CRC-16/XMODEM and CRC-16/GENIBUS). The tables are
+  // static data members of class templates, so the linker keeps a single
+  // copy of each of them for the whole program.
+
+  template<typename UnsignedIntegralType,
+           const std::size_t SliceCount>
+  struct crc_slicing_array
+  {
+    UnsignedIntegralType values[SliceCount][256U];
+  };
+
+  template<typename UnsignedIntegralType,
+           const bool ReflectIn,
+           const std::size_t SliceCount>
+  constexpr crc_slicing_array<UnsignedIntegralType, SliceCount> crc_slicing_make(const crc_table_array<UnsignedIntegralType>& byte_table)
+  {
+    using value_type = UnsignedIntegralType;
+
+    // Here values[k] is the table of slice k + 1.
+    crc_slicing_array<value_type, SliceCount> tables { };
+
+    for(std::size_t slice = 0U; slice < SliceCount; ++slice)
+    {
+      for(std::size_t i = 0U; i < 256U; ++i)
+      {
+        const value_type previous = ((slice == 0U) ? byte_table.values[i] : tables.values[slice - 1U][i]);
+
+        tables.values[slice][i] =
+          ((ReflectIn == false)
+            ? value_type(value_type(previous << 8) ^ byte_table.values[std::uint8_t(previous >> (std::numeric_limits<value_type>::digits - 8))])
+            : value_type(value_type(previous >> 8) ^ byte_table.values[std::uint8_t(previous)]));
+      }
+    }
+
+    return tables;
+  }
+
+  template<const std::size_t NumberOfBits,
+           const crc_value_type<NumberOfBits> Polynomial,
+           const bool ReflectIn,
+           const std::size_t SliceCount>
+  struct crc_slicing_table
+  {
+    using value_type      = crc_value_type<NumberOfBits>;
+    using byte_table_type = crc_table<NumberOfBits, Polynomial, ReflectIn>;
+    using table_type      = crc_slicing_array<value_type, ((SliceCount > 1U) ? (SliceCount - 1U) : 1U)>;
+
+    static_assert(SliceCount > 0U, "Error: The slice count must be at least one.");
+
+    // The tables of the slices 1 to SliceCount - 1.
+    static constexpr table_type table = crc_slicing_make<value_type, ReflectIn, ((SliceCount > 1U) ? (SliceCount - 1U) : 1U)>(byte_table_type::table);
+
+    // The tables of the slices, including the one of crc_table
+    // (which also processes the remaining bytes).
+    static constexpr std::size_t table_size()
+    {
+      return ((SliceCount - 1U) * sizeof(crc_table_array<value_type>)) + byte_table_type::table_size();
+    }
+
+    static constexpr value_type update(value_type crc, const std::uint8_t* message, std::size_t count)
+    {
+      while(count >= SliceCount)
+      {
+        crc = step(crc, message, std::make_index_sequence<SliceCount>());
+
+        message += SliceCount;
+        count   -= SliceCount;
+      }
+
+      // Process the remaining bytes one at a time.
+      return byte_table_type::update(crc, message, count);
+    }
+
+  private:
+    static constexpr std::size_t register_byte_count =
+      ((SliceCount < sizeof(value_type)) ? SliceCount : sizeof(value_type));
+
+    template<const std::size_t Slice>
+    static constexpr value_type slice_entry(const std::uint8_t byte_value)
+    {
+      return ((Slice == 0U) ? byte_table_type::table.values[byte_value]
+                            : table.values[(Slice == 0U) ? 0U : (Slice - 1U)][byte_value]);
+    }
+
+    template<const std::size_t ByteIndex>
+    static constexpr std::uint8_t step_byte(const value_type& crc, const std::uint8_t* message)
+    {
+      // Fold the register into the leading bytes of the step.
       const std::size_t right_shift_amount =
-        std::size_t(std::size_t(std::numeric_limits<value_type>::digits) - NumberOfBits);
+        ((ByteIndex >= register_byte_count)
+          ? 0U
+          : ((ReflectIn == false) ? std::size_t(std::size_t(std::numeric_limits<value_type>::digits - 8) - (8U * ByteIndex))
+                                  : std::size_t(8U * ByteIndex)));
 
-      crc >>= right_shift_amount;
+      return ((ByteIndex < register_byte_count) ? std::uint8_t(message[ByteIndex] ^ std::uint8_t(crc >> right_shift_amount))
+                                                : message[ByteIndex]);
     }
 
-    if(reflect_out == true)
+    template<const std::size_t... ByteIndex>
+    static constexpr value_type step(const value_type& crc, const std::uint8_t* message, std::index_sequence<ByteIndex...>)
     {
-      // Reflect the output result if necessary.
-      crc = detail::crc_reflect_template<NumberOfBits>(crc);
+      // Register bytes that are not folded into the step (which occurs only
+      // if the step is shorter than the register) are shifted instead.
+      const std::size_t register_shift_amount =
+        ((SliceCount < sizeof(value_type)) ? std::size_t(8U * SliceCount) : 0U);
+
+      value_type next_crc =
+        ((SliceCount < sizeof(value_type))
+          ? ((ReflectIn == false) ? value_type(crc << register_shift_amount)
+                                  : value_type(crc >> register_shift_amount))
+          : value_type(0U));
+
+      // All of the table lookups in the step are independent of each other.
+      using expander_type = int[];
+
+      static_cast<void>(expander_type { 0, (next_crc ^= slice_entry<(SliceCount - 1U) - ByteIndex>(step_byte<ByteIndex>(crc, message)), 0)... });
+
+      return next_crc;
     }
+  };
 
-    // Perform the final XOR on the result.
-    crc ^= final_xor_value;
+  template<const std::size_t NumberOfBits,
+           const crc_value_type<NumberOfBits> Polynomial,
+           const bool ReflectIn,
+           const std::size_t SliceCount>
+  constexpr typename crc_slicing_table<NumberOfBits, Polynomial, ReflectIn, SliceCount>::table_type crc_slicing_table<NumberOfBits, Polynomial, ReflectIn, SliceCount>::table;
 
-    return crc;
+  // Convert the initial value to and the final register from
+  // the register layout used by the table-driven engines.
+
+  template<const std::size_t NumberOfBits,
+           const bool ReflectIn>
+  constexpr crc_value_type<NumberOfBits> crc_register_initialize(const crc_value_type<NumberOfBits>& initial_value)
+  {
+    using value_type = crc_value_type<NumberOfBits>;
+
+    const std::size_t left_shift_amount =
+      std::size_t(std::size_t(std::numeric_limits<value_type>::digits) - NumberOfBits);
+
+    return ((ReflectIn == false) ? value_type(initial_value << left_shift_amount)
+                                 : crc_reflect_template<NumberOfBits, value_type>(initial_value));
+  }
+
+  template<const std::size_t NumberOfBits,
+           const bool ReflectIn>
+  constexpr crc_value_type<NumberOfBits> crc_register_finalize(const crc_value_type<NumberOfBits>& crc,
+                                                               const crc_value_type<NumberOfBits>& final_xor_value,
+                                                               const bool                          reflect_out)
+  {
+    using value_type = crc_value_type<NumberOfBits>;
+
+    const std::size_t right_shift_amount =
+      std::size_t(std::size_t(std::numeric_limits<value_type>::digits) - NumberOfBits);
+
+    value_type result = ((ReflectIn == false) ? value_type(crc >> right_shift_amount) : crc);
+
+    if(reflect_out != ReflectIn)
+    {
+      // The register is reflected if and only if the input is reflected.
+      // Reflect the output result if this differs from the requested output.
+      result = crc_reflect_template<NumberOfBits, value_type>(result);
+    }
+
+    return value_type(result ^ final_xor_value);
+  }
+
+  // The portable engine used when no hardware acceleration applies:
+  // byte-at-a-time tables for CRCs up to 8 bits, otherwise slicing-by-N.
+
+  template<const std::size_t NumberOfBits,
+           const crc_value_type<NumberOfBits> Polynomial,
+           const bool ReflectIn>
+  using crc_portable_engine =
+    typename std::conditional<(NumberOfBits <= 8U),
+                              crc_table        <NumberOfBits, Polynomial, ReflectIn>,
+                              crc_slicing_table<NumberOfBits, Polynomial, ReflectIn, CRC_CATALOG_SLICE_COUNT>>::type;
+
+  #if defined(CRC_CATALOG_HAS_CLMUL) || defined(CRC_CATALOG_HAS_CRC32C_SSE42)
+
+  inline unsigned int crc_cpuid_leaf1_ecx()
+  {
+    unsigned int ecx_value = 0U;
+
+    #if defined(_MSC_VER) && !defined(__clang__)
+    int cpu_info[4] = { 0, 0, 0, 0 };
+
+    __cpuid(cpu_info, 1);
+
+    ecx_value = static_cast<unsigned int>(cpu_info[2]);
+    #else
+    unsigned int eax_value = 0U;
+    unsigned int ebx_value = 0U;
+    unsigned int edx_value = 0U;
+
+    if(__get_cpuid(1U, &eax_value, &ebx_value, &ecx_value, &edx_value) == 0)
+    {
+      ecx_value = 0U;
+    }
+    #endif
+
+    return ecx_value;
   }
 
-  inline std::uint8_t  crc_crc03_gsm         (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 3U>(message, count, std::uint8_t (UINTMAX_C(0x0000000000000003)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000007)), false, false); } // check: 0x0000000000000004
-  inline std::uint8_t  crc_crc03_rohc        (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 3U>(message, count, std::uint8_t (UINTMAX_C(0x0000000000000003)), std::uint8_t (UINTMAX_C(0x0000000000000007)), std::uint8_t (UINTMAX_C(0x0000000000000000)), true,  true ); } // check: 0x0000000000000006
-  inline std::uint8_t  crc_crc04_interlaken  (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 4U>(message, count, std::uint8_t (UINTMAX_C(0x0000000000000003)), std::uint8_t (UINTMAX_C(0x000000000000000F)), std::uint8_t (UINTMAX_C(0x000000000000000F)), false, false); } // check: 0x000000000000000B
-  inline std::uint8_t  crc_crc04_itu         (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 4U>(message, count, std::uint8_t (UINTMAX_C(0x0000000000000003)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), true,  true ); } // check: 0x0000000000000007
-  inline std::uint8_t  crc_crc05_epc         (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 5U>(message, count, std::uint8_t (UINTMAX_C(0x0000000000000009)), std::uint8_t (UINTMAX_C(0x0000000000000009)), std::uint8_t (UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x0000000000000000
-  inline std::uint8_t  crc_crc05_itu         (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 5U>(message, count, std::uint8_t (UINTMAX_C(0x0000000000000015)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), true,  true ); } // check: 0x0000000000000007
-  inline std::uint8_t  crc_crc05_usb         (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 5U>(message, count, std::uint8_t (UINTMAX_C(0x0000000000000005)), std::uint8_t (UINTMAX_C(0x000000000000001F)), std::uint8_t (UINTMAX_C(0x000000000000001F)), true,  true ); } // check: 0x0000000000000019
-  inline std::uint8_t  crc_crc06_cdma2000_a  (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 6U>(message, count, std::uint8_t (UINTMAX_C(0x0000000000000027)), std::uint8_t (UINTMAX_C(0x000000000000003F)), std::uint8_t (UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x000000000000000D
-  inline std::uint8_t  crc_crc06_cdma2000_b  (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 6U>(message, count, std::uint8_t (UINTMAX_C(0x0000000000000007)), std::uint8_t (UINTMAX_C(0x000000000000003F)), std::uint8_t (UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x000000000000003B
-  inline std::uint8_t  crc_crc06_darc        (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 6U>(message, count, std::uint8_t (UINTMAX_C(0x0000000000000019)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), true,  true ); } // check: 0x0000000000000026
-  inline std::uint8_t  crc_crc06_gsm         (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 6U>(message, count, std::uint8_t (UINTMAX_C(0x000000000000002F)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x000000000000003F)), false, false); } // check: 0x0000000000000013
-  inline std::uint8_t  crc_crc06_itu         (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 6U>(message, count, std::uint8_t (UINTMAX_C(0x0000000000000003)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), true,  true ); } // check: 0x0000000000000006
-  inline std::uint8_t  crc_crc07             (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 7U>(message, count, std::uint8_t (UINTMAX_C(0x0000000000000009)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x0000000000000075
-  inline std::uint8_t  crc_crc07_rohc        (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 7U>(message, count, std::uint8_t (UINTMAX_C(0x000000000000004F)), std::uint8_t (UINTMAX_C(0x000000000000007F)), std::uint8_t (UINTMAX_C(0x0000000000000000)), true,  true ); } // check: 0x0000000000000053
-  inline std::uint8_t  crc_crc07_umts        (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 7U>(message, count, std::uint8_t (UINTMAX_C(0x0000000000000045)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x0000000000000061
-  inline std::uint8_t  crc_crc08             (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 8U>(message, count, std::uint8_t (UINTMAX_C(0x0000000000000007)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x00000000000000F4
-  inline std::uint8_t  crc_crc08_autosar     (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 8U>(message, count, std::uint8_t (UINTMAX_C(0x000000000000002F)), std::uint8_t (UINTMAX_C(0x00000000000000FF)), std::uint8_t (UINTMAX_C(0x00000000000000FF)), false, false); } // check: 0x00000000000000DF
-  inline std::uint8_t  crc_crc08_bluetooth   (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 8U>(message, count, std::uint8_t (UINTMAX_C(0x00000000000000A7)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), true,  true ); } // check: 0x0000000000000026
-  inline std::uint8_t  crc_crc08_cdma2000    (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 8U>(message, count, std::uint8_t (UINTMAX_C(0x000000000000009B)), std::uint8_t (UINTMAX_C(0x00000000000000FF)), std::uint8_t (UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x00000000000000DA
-  inline std::uint8_t  crc_crc08_darc        (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 8U>(message, count, std::uint8_t (UINTMAX_C(0x0000000000000039)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), true,  true ); } // check: 0x0000000000000015
-  inline std::uint8_t  crc_crc08_dvb_s2      (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 8U>(message, count, std::uint8_t (UINTMAX_C(0x00000000000000D5)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x00000000000000BC
-  inline std::uint8_t  crc_crc08_ebu         (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 8U>(message, count, std::uint8_t (UINTMAX_C(0x000000000000001D)), std::uint8_t (UINTMAX_C(0x00000000000000FF)), std::uint8_t (UINTMAX_C(0x0000000000000000)), true,  true ); } // check: 0x0000000000000097
-  inline std::uint8_t  crc_crc08_gsm_a       (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 8U>(message, count, std::uint8_t (UINTMAX_C(0x000000000000001D)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x0000000000000037
-  inline std::uint8_t  crc_crc08_gsm_b       (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 8U>(message, count, std::uint8_t (UINTMAX_C(0x0000000000000049)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x00000000000000FF)), false, false); } // check: 0x0000000000000094
-  inline std::uint8_t  crc_crc08_i_code      (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 8U>(message, count, std::uint8_t (UINTMAX_C(0x000000000000001D)), std::uint8_t (UINTMAX_C(0x00000000000000FD)), std::uint8_t (UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x000000000000007E
-  inline std::uint8_t  crc_crc08_itu         (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 8U>(message, count, std::uint8_t (UINTMAX_C(0x0000000000000007)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000055)), false, false); } // check: 0x00000000000000A1
-  inline std::uint8_t  crc_crc08_lte         (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 8U>(message, count, std::uint8_t (UINTMAX_C(0x000000000000009B)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x00000000000000EA
-  inline std::uint8_t  crc_crc08_maxim       (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 8U>(message, count, std::uint8_t (UINTMAX_C(0x0000000000000031)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), true,  true ); } // check: 0x00000000000000A1
-  inline std::uint8_t  crc_crc08_opensafety  (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 8U>(message, count, std::uint8_t (UINTMAX_C(0x000000000000002F)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x000000000000003E
-  inline std::uint8_t  crc_crc08_rohc        (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 8U>(message, count, std::uint8_t (UINTMAX_C(0x0000000000000007)), std::uint8_t (UINTMAX_C(0x00000000000000FF)), std::uint8_t (UINTMAX_C(0x0000000000000000)), true,  true ); } // check: 0x00000000000000D0
-  inline std::uint8_t  crc_crc08_sae_j1850   (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 8U>(message, count, std::uint8_t (UINTMAX_C(0x000000000000001D)), std::uint8_t (UINTMAX_C(0x00000000000000FF)), std::uint8_t (UINTMAX_C(0x00000000000000FF)), false, false); } // check: 0x000000000000004B
-  inline std::uint8_t  crc_crc08_wcdma       (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template< 8U>(message, count, std::uint8_t (UINTMAX_C(0x000000000000009B)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), true,  true ); } // check: 0x0000000000000025
-  inline std::uint16_t crc_crc10             (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<10U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000000233)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x0000000000000199
-  inline std::uint16_t crc_crc10_cdma2000    (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<10U>(message, count, std::uint16_t(UINTMAX_C(0x00000000000003D9)), std::uint16_t(UINTMAX_C(0x00000000000003FF)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x0000000000000233
-  inline std::uint16_t crc_crc10_gsm         (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<10U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000000175)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x00000000000003FF)), false, false); } // check: 0x000000000000012A
-  inline std::uint16_t crc_crc11             (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<11U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000000385)), std::uint16_t(UINTMAX_C(0x000000000000001A)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x00000000000005A3
-  inline std::uint16_t crc_crc11_umts        (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<11U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000000307)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x0000000000000061
-  inline std::uint16_t crc_crc12_cdma2000    (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<12U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000000F13)), std::uint16_t(UINTMAX_C(0x0000000000000FFF)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x0000000000000D4D
-  inline std::uint16_t crc_crc12_dect        (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<12U>(message, count, std::uint16_t(UINTMAX_C(0x000000000000080F)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x0000000000000F5B
-  inline std::uint16_t crc_crc12_gsm         (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<12U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000000D31)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000FFF)), false, false); } // check: 0x0000000000000B34
-  inline std::uint16_t crc_crc12_umts        (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<12U>(message, count, std::uint16_t(UINTMAX_C(0x000000000000080F)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, true ); } // check: 0x0000000000000DAF
-  inline std::uint16_t crc_crc13_bbc         (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<13U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000001CF5)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x00000000000004FA
-  inline std::uint16_t crc_crc14_darc        (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<14U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000000805)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), true,  true ); } // check: 0x000000000000082D
-  inline std::uint16_t crc_crc14_gsm         (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<14U>(message, count, std::uint16_t(UINTMAX_C(0x000000000000202D)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000003FFF)), false, false); } // check: 0x00000000000030AE
-  inline std::uint16_t crc_crc15             (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<15U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000004599)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x000000000000059E
-  inline std::uint16_t crc_crc15_mpt1327     (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<15U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000006815)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000001)), false, false); } // check: 0x0000000000002566
-  inline std::uint16_t crc_crc16_arc         (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000008005)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), true,  true ); } // check: 0x000000000000BB3D
-  inline std::uint16_t crc_crc16_aug_ccitt   (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000001021)), std::uint16_t(UINTMAX_C(0x0000000000001D0F)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x000000000000E5CC
-  inline std::uint16_t crc_crc16_buypass     (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000008005)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x000000000000FEE8
-  inline std::uint16_t crc_crc16_ccitt_false (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000001021)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x00000000000029B1
-  inline std::uint16_t crc_crc16_cdma2000    (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x000000000000C867)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x0000000000004C06
-  inline std::uint16_t crc_crc16_cms         (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000008005)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x000000000000AEE7
-  inline std::uint16_t crc_crc16_dds_110     (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000008005)), std::uint16_t(UINTMAX_C(0x000000000000800D)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x0000000000009ECF
-  inline std::uint16_t crc_crc16_dect_r      (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000000589)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000001)), false, false); } // check: 0x000000000000007E
-  inline std::uint16_t crc_crc16_dect_x      (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000000589)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x000000000000007F
-  inline std::uint16_t crc_crc16_dnp         (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000003D65)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), true,  true ); } // check: 0x000000000000EA82
-  inline std::uint16_t crc_crc16_en_13757    (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000003D65)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), false, false); } // check: 0x000000000000C2B7
-  inline std::uint16_t crc_crc16_genibus     (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000001021)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), false, false); } // check: 0x000000000000D64E
-  inline std::uint16_t crc_crc16_gsm         (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000001021)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), false, false); } // check: 0x000000000000CE3C
-  inline std::uint16_t crc_crc16_lj1200      (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000006F63)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x000000000000BDF4
-  inline std::uint16_t crc_crc16_maxim       (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000008005)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), true,  true ); } // check: 0x00000000000044C2
-  inline std::uint16_t crc_crc16_mcrf4xx     (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000001021)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), std::uint16_t(UINTMAX_C(0x0000000000000000)), true,  true ); } // check: 0x0000000000006F91
-  inline std::uint16_t crc_crc16_opensafety_a(const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000005935)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x0000000000005D38
-  inline std::uint16_t crc_crc16_opensafety_b(const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x000000000000755B)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x00000000000020FE
-  inline std::uint16_t crc_crc16_profibus    (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000001DCF)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), false, false); } // check: 0x000000000000A819
-  inline std::uint16_t crc_crc16_riello      (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000001021)), std::uint16_t(UINTMAX_C(0x000000000000B2AA)), std::uint16_t(UINTMAX_C(0x0000000000000000)), true,  true ); } // check: 0x00000000000063D0
-  inline std::uint16_t crc_crc16_t10_dif     (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000008BB7)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x000000000000D0DB
-  inline std::uint16_t crc_crc16_teledisk    (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x000000000000A097)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x0000000000000FB3
-  inline std::uint16_t crc_crc16_tms37157    (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000001021)), std::uint16_t(UINTMAX_C(0x00000000000089EC)), std::uint16_t(UINTMAX_C(0x0000000000000000)), true,  true ); } // check: 0x00000000000026B1
-  inline std::uint16_t crc_crc16_usb         (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000008005)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), true,  true ); } // check: 0x000000000000B4C8
-  inline std::uint16_t crc_crc16_a           (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000001021)), std::uint16_t(UINTMAX_C(0x000000000000C6C6)), std::uint16_t(UINTMAX_C(0x0000000000000000)), true,  true ); } // check: 0x000000000000BF05
-  inline std::uint16_t crc_crc16_kermit      (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000001021)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), true,  true ); } // check: 0x0000000000002189
-  inline std::uint16_t crc_crc16_modbus      (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000008005)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), std::uint16_t(UINTMAX_C(0x0000000000000000)), true,  true ); } // check: 0x0000000000004B37
-  inline std::uint16_t crc_crc16_x_25        (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000001021)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), true,  true ); } // check: 0x000000000000906E
-  inline std::uint16_t crc_crc16_xmodem      (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<16U>(message, count, std::uint16_t(UINTMAX_C(0x0000000000001021)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x00000000000031C3
-  inline std::uint32_t crc_crc17_can_fd      (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<17U>(message, count, std::uint32_t(UINTMAX_C(0x000000000001685B)), std::uint32_t(UINTMAX_C(0x0000000000000000)), std::uint32_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x0000000000004F03
-  inline std::uint32_t crc_crc21_can_fd      (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<21U>(message, count, std::uint32_t(UINTMAX_C(0x0000000000102899)), std::uint32_t(UINTMAX_C(0x0000000000000000)), std::uint32_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x00000000000ED841
-  inline std::uint32_t crc_crc24             (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<24U>(message, count, std::uint32_t(UINTMAX_C(0x0000000000864CFB)), std::uint32_t(UINTMAX_C(0x0000000000B704CE)), std::uint32_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x000000000021CF02
-  inline std::uint32_t crc_crc24_ble         (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<24U>(message, count, std::uint32_t(UINTMAX_C(0x000000000000065B)), std::uint32_t(UINTMAX_C(0x0000000000555555)), std::uint32_t(UINTMAX_C(0x0000000000000000)), true,  true ); } // check: 0x0000000000C25A56
-  inline std::uint32_t crc_crc24_flexray_a   (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<24U>(message, count, std::uint32_t(UINTMAX_C(0x00000000005D6DCB)), std::uint32_t(UINTMAX_C(0x0000000000FEDCBA)), std::uint32_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x00000000007979BD
-  inline std::uint32_t crc_crc24_flexray_b   (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<24U>(message, count, std::uint32_t(UINTMAX_C(0x00000000005D6DCB)), std::uint32_t(UINTMAX_C(0x0000000000ABCDEF)), std::uint32_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x00000000001F23B8
-  inline std::uint32_t crc_crc24_interlaken  (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<24U>(message, count, std::uint32_t(UINTMAX_C(0x0000000000328B63)), std::uint32_t(UINTMAX_C(0x0000000000FFFFFF)), std::uint32_t(UINTMAX_C(0x0000000000FFFFFF)), false, false); } // check: 0x0000000000B4F3E6
-  inline std::uint32_t crc_crc24_lte_a       (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<24U>(message, count, std::uint32_t(UINTMAX_C(0x0000000000864CFB)), std::uint32_t(UINTMAX_C(0x0000000000000000)), std::uint32_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x0000000000CDE703
-  inline std::uint32_t crc_crc24_lte_b       (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<24U>(message, count, std::uint32_t(UINTMAX_C(0x0000000000800063)), std::uint32_t(UINTMAX_C(0x0000000000000000)), std::uint32_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x000000000023EF52
-  inline std::uint32_t crc_crc30_cdma        (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<30U>(message, count, std::uint32_t(UINTMAX_C(0x000000002030B9C7)), std::uint32_t(UINTMAX_C(0x000000003FFFFFFF)), std::uint32_t(UINTMAX_C(0x000000003FFFFFFF)), false, false); } // check: 0x0000000004C34ABF
-  inline std::uint32_t crc_crc31_philips     (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<31U>(message, count, std::uint32_t(UINTMAX_C(0x0000000004C11DB7)), std::uint32_t(UINTMAX_C(0x000000007FFFFFFF)), std::uint32_t(UINTMAX_C(0x000000007FFFFFFF)), false, false); } // check: 0x000000000CE9E46C
-  inline std::uint32_t crc_crc32             (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<32U>(message, count, std::uint32_t(UINTMAX_C(0x0000000004C11DB7)), std::uint32_t(UINTMAX_C(0x00000000FFFFFFFF)), std::uint32_t(UINTMAX_C(0x00000000FFFFFFFF)), true,  true ); } // check: 0x00000000CBF43926
-  inline std::uint32_t crc_crc32_autosar     (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<32U>(message, count, std::uint32_t(UINTMAX_C(0x00000000F4ACFB13)), std::uint32_t(UINTMAX_C(0x00000000FFFFFFFF)), std::uint32_t(UINTMAX_C(0x00000000FFFFFFFF)), true,  true ); } // check: 0x000000001697D06A
-  inline std::uint32_t crc_crc32_bzip2       (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<32U>(message, count, std::uint32_t(UINTMAX_C(0x0000000004C11DB7)), std::uint32_t(UINTMAX_C(0x00000000FFFFFFFF)), std::uint32_t(UINTMAX_C(0x00000000FFFFFFFF)), false, false); } // check: 0x00000000FC891918
-  inline std::uint32_t crc_crc32_c           (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<32U>(message, count, std::uint32_t(UINTMAX_C(0x000000001EDC6F41)), std::uint32_t(UINTMAX_C(0x00000000FFFFFFFF)), std::uint32_t(UINTMAX_C(0x00000000FFFFFFFF)), true,  true ); } // check: 0x00000000E3069283
-  inline std::uint32_t crc_crc32_d           (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<32U>(message, count, std::uint32_t(UINTMAX_C(0x00000000A833982B)), std::uint32_t(UINTMAX_C(0x00000000FFFFFFFF)), std::uint32_t(UINTMAX_C(0x00000000FFFFFFFF)), true,  true ); } // check: 0x0000000087315576
-  inline std::uint32_t crc_crc32_mpeg_2      (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<32U>(message, count, std::uint32_t(UINTMAX_C(0x0000000004C11DB7)), std::uint32_t(UINTMAX_C(0x00000000FFFFFFFF)), std::uint32_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x000000000376E6E7
-  inline std::uint32_t crc_crc32_posix       (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<32U>(message, count, std::uint32_t(UINTMAX_C(0x0000000004C11DB7)), std::uint32_t(UINTMAX_C(0x0000000000000000)), std::uint32_t(UINTMAX_C(0x00000000FFFFFFFF)), false, false); } // check: 0x00000000765E7680
-  inline std::uint32_t crc_crc32_q           (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<32U>(message, count, std::uint32_t(UINTMAX_C(0x00000000814141AB)), std::uint32_t(UINTMAX_C(0x0000000000000000)), std::uint32_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x000000003010BF7F
-  inline std::uint32_t crc_crc32_jamcrc      (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<32U>(message, count, std::uint32_t(UINTMAX_C(0x0000000004C11DB7)), std::uint32_t(UINTMAX_C(0x00000000FFFFFFFF)), std::uint32_t(UINTMAX_C(0x0000000000000000)), true,  true ); } // check: 0x00000000340BC6D9
-  inline std::uint32_t crc_crc32_xfer        (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<32U>(message, count, std::uint32_t(UINTMAX_C(0x00000000000000AF)), std::uint32_t(UINTMAX_C(0x0000000000000000)), std::uint32_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x00000000BD0BE338
-  inline std::uint64_t crc_crc40_gsm         (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<40U>(message, count, std::uint64_t(UINTMAX_C(0x0000000004820009)), std::uint64_t(UINTMAX_C(0x0000000000000000)), std::uint64_t(UINTMAX_C(0x000000FFFFFFFFFF)), false, false); } // check: 0x000000D4164FC646
-  inline std::uint64_t crc_crc64             (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<64U>(message, count, std::uint64_t(UINTMAX_C(0x42F0E1EBA9EA3693)), std::uint64_t(UINTMAX_C(0x0000000000000000)), std::uint64_t(UINTMAX_C(0x0000000000000000)), false, false); } // check: 0x6C40DF5F0B497347
-  inline std::uint64_t crc_crc64_go_iso      (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<64U>(message, count, std::uint64_t(UINTMAX_C(0x000000000000001B)), std::uint64_t(UINTMAX_C(0xFFFFFFFFFFFFFFFF)), std::uint64_t(UINTMAX_C(0xFFFFFFFFFFFFFFFF)), true,  true ); } // check: 0xB90956C775A41001
-  inline std::uint64_t crc_crc64_we          (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<64U>(message, count, std::uint64_t(UINTMAX_C(0x42F0E1EBA9EA3693)), std::uint64_t(UINTMAX_C(0xFFFFFFFFFFFFFFFF)), std::uint64_t(UINTMAX_C(0xFFFFFFFFFFFFFFFF)), false, false); } // check: 0x62EC59E3F1A4F00A
-  inline std::uint64_t crc_crc64_xz          (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<64U>(message, count, std::uint64_t(UINTMAX_C(0x42F0E1EBA9EA3693)), std::uint64_t(UINTMAX_C(0xFFFFFFFFFFFFFFFF)), std::uint64_t(UINTMAX_C(0xFFFFFFFFFFFFFFFF)), true,  true ); } // check: 0x995DC9BBDF1939FA
-  inline std::uint64_t crc_crc64_jones_redis (const std::uint8_t* message, const std::size_t count) { return crc_bitwise_template<64U>(message, count, std::uint64_t(UINTMAX_C(0xAD93D23594C935A9)), std::uint64_t(UINTMAX_C(0x0000000000000000)), std::uint64_t(UINTMAX_C(0x0000000000000000)), true,  true ); } // check: 0xE9C6D914C4B8D9CA
+  #endif
+
+  #if defined(CRC_CATALOG_HAS_CLMUL)
+
+  // Carry-less multiplication folding (PCLMULQDQ) with Barrett reduction.
+  // A CRC of width NumberOfBits with polynomial P is computed as a 64-bit CRC
+  // with the polynomial G = x^64 + (P * x^(64 - NumberOfBits)). The register
+  // of this CRC is the left-justified register of the original CRC, so that
+  // every catalog CRC up to 64 bits uses the same folding kernel.
+  // The fold and Barrett constants are derived at compile time.
+  // Reflected CRCs are folded in the reflected domain, where the fold
+  // constants absorb the extra factor x of the carry-less product.
+
+  constexpr std::uint64_t crc_clmul_xpow_mod(const std::uint64_t polynomial_low, const std::size_t exponent)
+  {
+    // Compute x^exponent mod G, where G = x^64 + polynomial_low.
+    std::uint64_t remainder(1U);
+
+    for(std::size_t i = 0U; i < exponent; ++i)
+    {
+      const bool high_bit_is_set = ((remainder >> 63) != 0U);
+
+      remainder <<= 1;
+
+      if(high_bit_is_set)
+      {
+        remainder ^= polynomial_low;
+      }
+    }
+
+    return remainder;
+  }
+
+  constexpr std::uint64_t crc_clmul_barrett_mu(const std::uint64_t polynomial_low)
+  {
+    // Compute floor(x^128 / G) by long division, without its leading term x^64.
+    std::uint64_t remainder(0U);
+    std::uint64_t quotient (0U);
+
+    for(std::size_t k = 129U; k > 0U; --k)
+    {
+      const std::size_t dividend_bit = k - 1U;
+
+      const bool high_bit_is_set = ((remainder >> 63) != 0U);
+
+      remainder = std::uint64_t(remainder << 1) | ((dividend_bit == 128U) ? 1U : 0U);
+
+      if(high_bit_is_set)
+      {
+        remainder ^= polynomial_low;
+
+        if(dividend_bit < 64U)
+        {
+          quotient |= std::uint64_t(std::uint64_t(1U) << dividend_bit);
+        }
+      }
+    }
+
+    return quotient;
+  }
+
+  inline bool crc_clmul_is_supported()
+  {
+    // CPUID leaf 1: ECX bit 1 is PCLMULQDQ and ECX bit 9 is SSSE3.
+    static const bool clmul_is_supported =
+      (((crc_cpuid_leaf1_ecx() & (1U << 1)) != 0U) && ((crc_cpuid_leaf1_ecx() & (1U << 9)) != 0U));
+
+    return clmul_is_supported;
+  }
+
+  template<const std::size_t NumberOfBits,
+           const crc_value_type<NumberOfBits> Polynomial,
+           const bool ReflectIn>
+  struct crc_clmul
+  {
+    using value_type = crc_value_type<NumberOfBits>;
+
+    // The folding kernel needs at least one 16-byte block. Long messages
+    // are folded 64 bytes per step, and a final partial block is merged
+    // with the overlapping last 16 bytes of the message. Shorter messages
+    // are handled by the portable engine.
+    static constexpr std::size_t minimum_count = 16U;
+
+    static constexpr std::uint64_t polynomial_low = std::uint64_t(std::uint64_t(Polynomial) << (64U - NumberOfBits));
+
+    static constexpr std::uint64_t constant(const std::uint64_t value)
+    {
+      return ((ReflectIn == false) ? value : crc_reflect_template<64U, std::uint64_t>(value));
+    }
+
+    // The constants for the (low, high) 64-bit lanes of the 128-bit accumulators.
+    // A normal lane holding x^i..x^(i+63) is multiplied by x^(T+i) mod G for the
+    // fold distance T. In the reflected domain, the low lane holds the higher
+    // powers and the product carries an extra factor of x.
+    static constexpr std::uint64_t fold_512_lo = constant(crc_clmul_xpow_mod(polynomial_low, (ReflectIn == false) ? 512U : 575U));
+    static constexpr std::uint64_t fold_512_hi = constant(crc_clmul_xpow_mod(polynomial_low, (ReflectIn == false) ? 576U : 511U));
+    static constexpr std::uint64_t fold_128_lo = constant(crc_clmul_xpow_mod(polynomial_low, (ReflectIn == false) ? 128U : 191U));
+    static constexpr std::uint64_t fold_128_hi = constant(crc_clmul_xpow_mod(polynomial_low, (ReflectIn == false) ? 192U : 127U));
+    static constexpr std::uint64_t fold_final  = constant(crc_clmul_xpow_mod(polynomial_low, (ReflectIn == false) ? 128U : 127U));
+    static constexpr std::uint64_t barrett_mu  = constant(crc_clmul_barrett_mu(polynomial_low));
+    static constexpr std::uint64_t barrett_g   = constant(polynomial_low);
+
+    CRC_CATALOG_TARGET_CLMUL
+    static value_type update(const value_type& crc, const std::uint8_t* message, const std::size_t count)
+    {
+      const std::uint8_t* message_end = message + count;
+
+      __m128i accumulator;
+
+      if(count >= 64U)
+      {
+        __m128i x0 = first_block(crc, message);
+        __m128i x1 = load(message + 16U);
+        __m128i x2 = load(message + 32U);
+        __m128i x3 = load(message + 48U);
+
+        message += 64U;
+
+        const __m128i k512 = _mm_set_epi64x(static_cast<long long>(fold_512_hi), static_cast<long long>(fold_512_lo));
+
+        while(std::size_t(message_end - message) >= 64U)
+        {
+          x0 = _mm_xor_si128(fold(x0, k512), load(message));
+          x1 = _mm_xor_si128(fold(x1, k512), load(message + 16U));
+          x2 = _mm_xor_si128(fold(x2, k512), load(message + 32U));
+          x3 = _mm_xor_si128(fold(x3, k512), load(message + 48U));
+
+          message += 64U;
+        }
+
+        const __m128i k128 = fold_128_constants();
+
+        x1 = _mm_xor_si128(fold(x0, k128), x1);
+        x2 = _mm_xor_si128(fold(x1, k128), x2);
+
+        accumulator = _mm_xor_si128(fold(x2, k128), x3);
+      }
+      else
+      {
+        accumulator = first_block(crc, message);
+
+        message += 16U;
+      }
+
+      while(std::size_t(message_end - message) >= 16U)
+      {
+        accumulator = next_block(accumulator, message);
+
+        message += 16U;
+      }
+
+      return last_block(accumulator, message_end, std::size_t(message_end - message));
+    }
+
+  private:
+    // The steps of the folding kernel: the first block (including the
+    // initial register), each following 16-byte block, and the final
+    // partial block followed by the reduction.
+
+    CRC_CATALOG_TARGET_CLMUL
+    static __m128i first_block(const value_type& crc, const std::uint8_t* message)
+    {
+      // The register is left-justified in 64 bits (or reflected and
+      // right-justified) and is folded into the first 64 message bits.
+      const std::uint64_t crc64 =
+        ((ReflectIn == false) ? std::uint64_t(std::uint64_t(crc) << (64 - std::numeric_limits<value_type>::digits))
+                              : std::uint64_t(crc));
+
+      const __m128i crc_block =
+        ((ReflectIn == false) ? _mm_slli_si128(_mm_cvtsi64_si128(static_cast<long long>(crc64)), 8)
+                              : _mm_cvtsi64_si128(static_cast<long long>(crc64)));
+
+      return _mm_xor_si128(load(message), crc_block);
+    }
+
+    CRC_CATALOG_TARGET_CLMUL
+    static __m128i next_block(const __m128i& accumulator, const std::uint8_t* message)
+    {
+      return _mm_xor_si128(fold(accumulator, fold_128_constants()), load(message));
+    }
+
+    CRC_CATALOG_TARGET_CLMUL
+    static value_type last_block(__m128i accumulator, const std::uint8_t* message_end, const std::size_t remaining)
+    {
+      if(remaining != 0U)
+      {
+        // Append the remaining (fewer than 16) bytes: the accumulator A is
+        // multiplied by x^(8 * remaining). Its overflowing part above x^127
+        // is folded, and the remaining bytes are taken from the last
+        // 16 bytes of the message, which overlap the previous block.
+        const __m128i tail = load(message_end - 16U);
+
+        __m128i overflow;
+
+        if(ReflectIn == false)
+        {
+          overflow    = _mm_shuffle_epi8(accumulator, load_raw(shuffle_table + (32U - remaining)));
+          accumulator = _mm_shuffle_epi8(accumulator, load_raw(shuffle_table + (16U - remaining)));
+          accumulator = _mm_or_si128(accumulator, _mm_and_si128(tail, load_raw(shuffle_table + (48U - remaining))));
+        }
+        else
+        {
+          // In the reflected domain, the higher powers are in the lower bytes.
+          overflow    = _mm_shuffle_epi8(accumulator, load_raw(shuffle_table + remaining));
+          accumulator = _mm_shuffle_epi8(accumulator, load_raw(shuffle_table + (16U + remaining)));
+          accumulator = _mm_or_si128(accumulator, _mm_andnot_si128(load_raw(shuffle_table + (32U + remaining)), tail));
+        }
+
+        accumulator = _mm_xor_si128(fold(overflow, fold_128_constants()), accumulator);
+      }
+
+      const std::uint64_t reduced = reduce(accumulator);
+
+      return ((ReflectIn == false) ? value_type(reduced >> (64 - std::numeric_limits<value_type>::digits))
+                                   : value_type(reduced));
+    }
+
+    // Masks for shifting by a variable number n of bytes with pshufb
+    // (loaded from offset 16 - n for a shift to higher bytes, or from
+    // offset 16 + n for a shift to lower bytes), where 0xFF zeroes a byte.
+    // Loading from offset 48 - n gives the mask of the lowest n bytes.
+    static constexpr std::uint8_t shuffle_table[64U] =
+    {
+      0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+      0x00U, 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U, 0x08U, 0x09U, 0x0AU, 0x0BU, 0x0CU, 0x0DU, 0x0EU, 0x0FU,
+      0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+      0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U
+    };
+
+    CRC_CATALOG_TARGET_CLMUL
+    static __m128i load_raw(const std::uint8_t* data)
+    {
+      return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    }
+
+    CRC_CATALOG_TARGET_CLMUL
+    static __m128i fold_128_constants()
+    {
+      return _mm_set_epi64x(static_cast<long long>(fold_128_hi), static_cast<long long>(fold_128_lo));
+    }
+
+    CRC_CATALOG_TARGET_CLMUL
+    static __m128i load(const std::uint8_t* message)
+    {
+      const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(message));
+
+      // Non-reflected CRCs consume the bytes in big-endian order.
+      return ((ReflectIn == false) ? _mm_shuffle_epi8(block, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15))
+                                   : block);
+    }
+
+    CRC_CATALOG_TARGET_CLMUL
+    static __m128i fold(const __m128i& accumulator, const __m128i& constants)
+    {
+      return _mm_xor_si128(_mm_clmulepi64_si128(accumulator, constants, 0x00),
+                           _mm_clmulepi64_si128(accumulator, constants, 0x11));
+    }
+
+    CRC_CATALOG_TARGET_CLMUL
+    static void clmul64(const std::uint64_t a, const std::uint64_t b, std::uint64_t& lo, std::uint64_t& hi)
+    {
+      const __m128i product = _mm_clmulepi64_si128(_mm_cvtsi64_si128(static_cast<long long>(a)),
+                                                   _mm_cvtsi64_si128(static_cast<long long>(b)),
+                                                   0x00);
+
+      lo = static_cast<std::uint64_t>(_mm_cvtsi128_si64(product));
+      hi = static_cast<std::uint64_t>(_mm_cvtsi128_si64(_mm_unpackhi_epi64(product, product)));
+    }
+
+    CRC_CATALOG_TARGET_CLMUL
+    static std::uint64_t reduce(const __m128i& accumulator)
+    {
+      // Compute (A * x^64) mod G for the 128-bit accumulator A,
+      // first folding A to 128 bits C and then using Barrett reduction
+      // with the quotient q = floor(C / G).
+      const std::uint64_t lane_lo = static_cast<std::uint64_t>(_mm_cvtsi128_si64(accumulator));
+      const std::uint64_t lane_hi = static_cast<std::uint64_t>(_mm_cvtsi128_si64(_mm_unpackhi_epi64(accumulator, accumulator)));
+
+      std::uint64_t c_lo;
+      std::uint64_t c_hi;
+      std::uint64_t product_lo;
+      std::uint64_t product_hi;
+
+      if(ReflectIn == false)
+      {
+        clmul64(lane_hi, fold_final, c_lo, c_hi);
+
+        c_hi ^= lane_lo;
+
+        clmul64(c_hi, barrett_mu, product_lo, product_hi);
+
+        const std::uint64_t quotient = c_hi ^ product_hi;
+
+        clmul64(quotient, barrett_g, product_lo, product_hi);
+
+        return c_lo ^ product_lo;
+      }
+      else
+      {
+        // In the reflected domain, the low lane holds the higher powers,
+        // and the carry-less products are shifted by one bit.
+        clmul64(lane_lo, fold_final, c_hi, c_lo);
+
+        c_hi ^= lane_hi;
+
+        clmul64(c_hi, barrett_mu, product_lo, product_hi);
+
+        const std::uint64_t quotient = c_hi ^ std::uint64_t(product_lo << 1);
+
+        clmul64(quotient, barrett_g, product_lo, product_hi);
+
+        return c_lo ^ std::uint64_t(std::uint64_t(product_hi << 1) | std::uint64_t(product_lo >> 63));
+      }
+    }
+  };
+
+  template<const std::size_t NumberOfBits,
+           const crc_value_type<NumberOfBits> Polynomial,
+           const bool ReflectIn>
+  constexpr std::uint8_t crc_clmul<NumberOfBits, Polynomial, ReflectIn>::shuffle_table[64U];
+
+  #endif // CRC_CATALOG_HAS_CLMUL
+
+  #if defined(CRC_CATALOG_HAS_CRC32C)
+
+  // The CRC-32C instruction path (crc32 on x86-64 with SSE4.2, crc32c on
+  // ARMv8). Long messages are split into three streams of equal length
+  // which are computed independently in order to hide the latency of the
+  // instruction. The stream registers are then merged by shifting them
+  // over the length of one stream. Shifting a reflected register over n
+  // zero bytes is multiplication with x^(8n) mod P, which is tabulated at
+  // compile time for each of the four register bytes.
+
+  constexpr std::uint32_t crc_crc32c_multiply(const std::uint32_t a, std::uint32_t b)
+  {
+    // Compute a * b mod P in the reflected domain, where x^0 is the high bit.
+    std::uint32_t product(0U);
+
+    for(std::size_t i = 0U; i < 32U; ++i)
+    {
+      if((a & std::uint32_t(UINT32_C(0x80000000) >> i)) != 0U)
+      {
+        product ^= b;
+      }
+
+      b = (((b & 1U) != 0U) ? std::uint32_t((b >> 1) ^ UINT32_C(0x82F63B78)) : std::uint32_t(b >> 1));
+    }
+
+    return product;
+  }
+
+  constexpr std::uint32_t crc_crc32c_xpow(std::size_t exponent)
+  {
+    // Compute x^exponent mod P by square-and-multiply.
+    std::uint32_t result(UINT32_C(0x80000000));
+    std::uint32_t power (UINT32_C(0x40000000));
+
+    for( ; exponent != 0U; exponent >>= 1)
+    {
+      if((exponent & 1U) != 0U)
+      {
+        result = crc_crc32c_multiply(result, power);
+      }
+
+      power = crc_crc32c_multiply(power, power);
+    }
+
+    return result;
+  }
+
+  constexpr crc_slicing_array<std::uint32_t, 4U> crc_crc32c_shift_make(const std::size_t byte_count)
+  {
+    crc_slicing_array<std::uint32_t, 4U> tables { };
+
+    const std::uint32_t shift_factor = crc_crc32c_xpow(8U * byte_count);
+
+    for(std::size_t slice = 0U; slice < 4U; ++slice)
+    {
+      for(std::size_t i = 0U; i < 256U; ++i)
+      {
+        tables.values[slice][i] = crc_crc32c_multiply(shift_factor, std::uint32_t(std::uint32_t(i) << (8U * slice)));
+      }
+    }
+
+    return tables;
+  }
+
+  inline bool crc_crc32c_is_supported()
+  {
+    #if defined(CRC_CATALOG_HAS_CRC32C_SSE42)
+    // CPUID leaf 1: ECX bit 20 is SSE4.2.
+    static const bool crc32c_is_supported = ((crc_cpuid_leaf1_ecx() & (1U << 20)) != 0U);
+    #elif defined(__linux__) && defined(HWCAP_CRC32)
+    static const bool crc32c_is_supported = ((getauxval(AT_HWCAP) & HWCAP_CRC32) != 0U);
+    #else
+    // The compiler targets the ARMv8 CRC32 extension.
+    static const bool crc32c_is_supported = true;
+    #endif
+
+    return crc32c_is_supported;
+  }
+
+  template<const std::size_t StreamLength>
+  struct crc_crc32c_shift
+  {
+    static constexpr crc_slicing_array<std::uint32_t, 4U> table = crc_crc32c_shift_make(StreamLength);
+
+    static std::uint32_t apply(const std::uint32_t crc)
+    {
+      return std::uint32_t(  table.values[0U][std::uint8_t(crc      )]
+                           ^ table.values[1U][std::uint8_t(crc >>  8)]
+                           ^ table.values[2U][std::uint8_t(crc >> 16)]
+                           ^ table.values[3U][std::uint8_t(crc >> 24)]);
+    }
+  };
+
+  template<const std::size_t StreamLength>
+  constexpr crc_slicing_array<std::uint32_t, 4U> crc_crc32c_shift<StreamLength>::table;
+
+  struct crc_crc32c_hardware
+  {
+    // The stream lengths of the long and the short three-way interleave.
+    static constexpr std::size_t long_stream_length  = 8192U;
+    static constexpr std::size_t short_stream_length =  256U;
+
+    #if defined(CRC_CATALOG_HAS_CRC32C_SSE42)
+    CRC_CATALOG_TARGET_SSE42
+    #endif
+    static std::uint32_t update(std::uint32_t crc, const std::uint8_t* message, std::size_t count)
+    {
+      while(count >= (3U * long_stream_length))
+      {
+        crc = update_streams<long_stream_length>(crc, message);
+
+        message += 3U * long_stream_length;
+        count   -= 3U * long_stream_length;
+      }
+
+      while(count >= (3U * short_stream_length))
+      {
+        crc = update_streams<short_stream_length>(crc, message);
+
+        message += 3U * short_stream_length;
+        count   -= 3U * short_stream_length;
+      }
+
+      while(count >= 8U)
+      {
+        crc = step_word(crc, message);
+
+        message += 8U;
+        count   -= 8U;
+      }
+
+      while(count > 0U)
+      {
+        crc = step_byte(crc, *message);
+
+        ++message;
+        --count;
+      }
+
+      return crc;
+    }
+
+  private:
+    template<const std::size_t StreamLength>
+    #if defined(CRC_CATALOG_HAS_CRC32C_SSE42)
+    CRC_CATALOG_TARGET_SSE42
+    #endif
+    static std::uint32_t update_streams(const std::uint32_t crc, const std::uint8_t* message)
+    {
+      std::uint32_t crc0 = crc;
+      std::uint32_t crc1 = 0U;
+      std::uint32_t crc2 = 0U;
+
+      for(std::size_t i = 0U; i < StreamLength; i += 8U)
+      {
+        crc0 = step_word(crc0, message + i);
+        crc1 = step_word(crc1, message + i + StreamLength);
+        crc2 = step_word(crc2, message + i + (2U * StreamLength));
+      }
+
+      crc0 = std::uint32_t(crc_crc32c_shift<StreamLength>::apply(crc0) ^ crc1);
+
+      return std::uint32_t(crc_crc32c_shift<StreamLength>::apply(crc0) ^ crc2);
+    }
+
+    #if defined(CRC_CATALOG_HAS_CRC32C_SSE42)
+    CRC_CATALOG_TARGET_SSE42
+    #endif
+    static std::uint32_t step_word(const std::uint32_t crc, const std::uint8_t* message)
+    {
+      // Assemble the little-endian word byte by byte. Compilers
+      // recognize this as a single (unaligned) load.
+      const std::uint64_t word =
+        std::uint64_t(  (std::uint64_t(message[0U]) <<  0) | (std::uint64_t(message[1U]) <<  8)
+                      | (std::uint64_t(message[2U]) << 16) | (std::uint64_t(message[3U]) << 24)
+                      | (std::uint64_t(message[4U]) << 32) | (std::uint64_t(message[5U]) << 40)
+                      | (std::uint64_t(message[6U]) << 48) | (std::uint64_t(message[7U]) << 56));
+
+      #if defined(CRC_CATALOG_HAS_CRC32C_SSE42)
+      return std::uint32_t(_mm_crc32_u64(crc, word));
+      #else
+      return std::uint32_t(__crc32cd(crc, word));
+      #endif
+    }
+
+    #if defined(CRC_CATALOG_HAS_CRC32C_SSE42)
+    CRC_CATALOG_TARGET_SSE42
+    #endif
+    static std::uint32_t step_byte(const std::uint32_t crc, const std::uint8_t value)
+    {
+      #if defined(CRC_CATALOG_HAS_CRC32C_SSE42)
+      return std::uint32_t(_mm_crc32_u8(crc, value));
+      #else
+      return std::uint32_t(__crc32cb(crc, value));
+      #endif
+    }
+  };
+
+  #endif // CRC_CATALOG_HAS_CRC32C
+
+  // The generic engine: carry-less multiplication folding
+  // where available, otherwise the portable engine.
+
+  template<const std::size_t NumberOfBits,
+           const crc_value_type<NumberOfBits> Polynomial,
+           const bool ReflectIn>
+  struct crc_generic_engine
+  {
+    using value_type = crc_value_type<NumberOfBits>;
+
+    // The folding constants are immediate values, so only the tables
+    // of the portable engine (used for short messages) remain.
+    static constexpr std::size_t table_size() { return crc_portable_engine<NumberOfBits, Polynomial, ReflectIn>::table_size(); }
+
+    static CRC_CATALOG_CONSTEXPR value_type update(value_type crc, const std::uint8_t* message, const std::size_t count)
+    {
+      if(CRC_CATALOG_IS_CONSTANT_EVALUATED())
+      {
+        return crc_portable_engine<NumberOfBits, Polynomial, ReflectIn>::update(crc, message, count);
+      }
+
+      #if defined(CRC_CATALOG_HAS_CLMUL)
+      // Folding outperforms the table-driven engines
+      // already at the minimum length of the kernel.
+      if((count >= crc_clmul<NumberOfBits, Polynomial, ReflectIn>::minimum_count) && crc_clmul_is_supported())
+      {
+        return crc_clmul<NumberOfBits, Polynomial, ReflectIn>::update(crc, message, count);
+      }
+      #endif
+
+      return crc_portable_engine<NumberOfBits, Polynomial, ReflectIn>::update(crc, message, count);
+    }
+  };
+
+  // The default engine of the named CRCs, selected at runtime.
+
+  template<const std::size_t NumberOfBits,
+           const crc_value_type<NumberOfBits> Polynomial,
+           const bool ReflectIn>
+  struct crc_default_engine : public crc_generic_engine<NumberOfBits, Polynomial, ReflectIn> { };
+
+  #if defined(CRC_CATALOG_HAS_CRC32C)
+
+  // CRC-32C (Castagnoli) uses the dedicated instructions if available.
+
+  template<>
+  struct crc_default_engine<32U, std::uint32_t(UINT32_C(0x1EDC6F41)), true>
+  {
+    using value_type = std::uint32_t;
+
+    static constexpr std::size_t table_size() { return crc_generic_engine<32U, std::uint32_t(UINT32_C(0x1EDC6F41)), true>::table_size(); }
+
+    static CRC_CATALOG_CONSTEXPR value_type update(value_type crc, const std::uint8_t* message, const std::size_t count)
+    {
+      if(CRC_CATALOG_IS_CONSTANT_EVALUATED())
+      {
+        return crc_portable_engine<32U, std::uint32_t(UINT32_C(0x1EDC6F41)), true>::update(crc, message, count);
+      }
+
+      return (crc_crc32c_is_supported()
+               ? crc_crc32c_hardware::update(crc, message, count)
+               : crc_generic_engine<32U, std::uint32_t(UINT32_C(0x1EDC6F41)), true>::update(crc, message, count));
+    }
+  };
+
+  #endif
+
+  #if defined(CRC_CATALOG_ENABLE_STATS)
+
+  // The engine that an engine type runs for a message of a given length,
+  // following the runtime selection of the engines above. It only changes
+  // from switch_count bytes on (never if switch_count is 0).
+
+  template<typename EngineType>
+  struct crc_stats_engine_of;
+
+  template<const std::size_t NumberOfBits, const crc_value_type<NumberOfBits> Polynomial, const bool ReflectIn>
+  struct crc_stats_engine_of<crc_bitwise<NumberOfBits, Polynomial, ReflectIn>>
+  {
+    static constexpr std::size_t switch_count = 0U;
+
+    static crc_stats_engine kind(const std::size_t) { return crc_stats_engine::bitwise; }
+  };
+
+  template<const std::size_t NumberOfBits, const crc_value_type<NumberOfBits> Polynomial, const bool ReflectIn>
+  struct crc_stats_engine_of<crc_nibble_table<NumberOfBits, Polynomial, ReflectIn>>
+  {
+    static constexpr std::size_t switch_count = 0U;
+
+    static crc_stats_engine kind(const std::size_t) { return crc_stats_engine::nibble; }
+  };
+
+  template<const std::size_t NumberOfBits, const crc_value_type<NumberOfBits> Polynomial, const bool ReflectIn>
+  struct crc_stats_engine_of<crc_nibble_pair<NumberOfBits, Polynomial, ReflectIn>>
+  {
+    static constexpr std::size_t switch_count = 0U;
+
+    static crc_stats_engine kind(const std::size_t) { return crc_stats_engine::nibble_pair; }
+  };
+
+  template<const std::size_t NumberOfBits, const crc_value_type<NumberOfBits> Polynomial, const bool ReflectIn>
+  struct crc_stats_engine_of<crc_table<NumberOfBits, Polynomial, ReflectIn>>
+  {
+    static constexpr std::size_t switch_count = 0U;
+
+    static crc_stats_engine kind(const std::size_t) { return crc_stats_engine::table; }
+  };
+
+  template<const std::size_t NumberOfBits, const crc_value_type<NumberOfBits> Polynomial, const bool ReflectIn, const std::size_t SliceCount>
+  struct crc_stats_engine_of<crc_slicing_table<NumberOfBits, Polynomial, ReflectIn, SliceCount>>
+  {
+    static constexpr std::size_t switch_count = 0U;
+
+    static crc_stats_engine kind(const std::size_t) { return crc_stats_engine::slicing; }
+  };
+
+  template<const std::size_t NumberOfBits, const crc_value_type<NumberOfBits> Polynomial, const bool ReflectIn>
+  struct crc_stats_engine_of<crc_generic_engine<NumberOfBits, Polynomial, ReflectIn>>
+  {
+    #if defined(CRC_CATALOG_HAS_CLMUL)
+    static constexpr std::size_t switch_count = crc_clmul<NumberOfBits, Polynomial, ReflectIn>::minimum_count;
+    #else
+    static constexpr std::size_t switch_count = 0U;
+    #endif
+
+    static crc_stats_engine kind(const std::size_t count)
+    {
+      #if defined(CRC_CATALOG_HAS_CLMUL)
+      if((count >= crc_clmul<NumberOfBits, Polynomial, ReflectIn>::minimum_count) && crc_clmul_is_supported())
+      {
+        return crc_stats_engine::clmul;
+      }
+      #endif
+
+      return crc_stats_engine_of<crc_portable_engine<NumberOfBits, Polynomial, ReflectIn>>::kind(count);
+    }
+  };
+
+  template<const std::size_t NumberOfBits, const crc_value_type<NumberOfBits> Polynomial, const bool ReflectIn>
+  struct crc_stats_engine_of<crc_default_engine<NumberOfBits, Polynomial, ReflectIn>>
+    : public crc_stats_engine_of<crc_generic_engine<NumberOfBits, Polynomial, ReflectIn>> { };
+
+  #if defined(CRC_CATALOG_HAS_CRC32C)
+
+  template<>
+  struct crc_stats_engine_of<crc_default_engine<32U, std::uint32_t(UINT32_C(0x1EDC6F41)), true>>
+  {
+    static constexpr std::size_t switch_count =
+      crc_stats_engine_of<crc_generic_engine<32U, std::uint32_t(UINT32_C(0x1EDC6F41)), true>>::switch_count;
+
+    static crc_stats_engine kind(const std::size_t count)
+    {
+      return (crc_crc32c_is_supported()
+               ? crc_stats_engine::crc32c
+               : crc_stats_engine_of<crc_generic_engine<32U, std::uint32_t(UINT32_C(0x1EDC6F41)), true>>::kind(count));
+    }
+  };
+
+  #endif
+
+  // The name under which the counters of an algorithm are reported:
+  // the catalog name if the parameter type provides one.
+
+  template<typename Params>
+  constexpr auto crc_stats_name(int) -> decltype(Params::name()) { return Params::name(); }
+
+  template<typename Params>
+  constexpr const char* crc_stats_name(long) { return "(unnamed)"; }
+
+  // The slot of an algorithm, shared by all of its engines.
+  template<typename Params>
+  std::size_t crc_stats_slot()
+  {
+    static const std::size_t slot = crc_stats_algorithm_slot(crc_stats_name<Params>(0));
+
+    return slot;
+  }
+
+  // The counters of an engine type in the calling thread. Plain
+  // thread-local variables are addressed directly, without the
+  // initialization checks of thread-local objects.
+  template<typename Params, typename EngineType>
+  struct crc_stats_thread_counters
+  {
+    static thread_local crc_stats_type_counters counters;
+    static thread_local bool                    is_registered;
+  };
+
+  template<typename Params, typename EngineType>
+  thread_local crc_stats_type_counters crc_stats_thread_counters<Params, EngineType>::counters;
+
+  template<typename Params, typename EngineType>
+  thread_local bool crc_stats_thread_counters<Params, EngineType>::is_registered = false;
+
+  // Register the counters of an engine type on its first recorded call in
+  // a thread. The engine type itself is resolved once.
+  template<typename Params, typename EngineType>
+  CRC_CATALOG_STATS_NOINLINE void crc_stats_register_thread_counters()
+  {
+    using engine_of_type = crc_stats_engine_of<EngineType>;
+
+    static const std::size_t type_index =
+      crc_stats_type_index(crc_stats_type { crc_stats_slot<Params>(),
+                                            engine_of_type::kind(0U),
+                                            engine_of_type::kind(engine_of_type::switch_count),
+                                            engine_of_type::switch_count });
+
+    using thread_counters_type = crc_stats_thread_counters<Params, EngineType>;
+
+    crc_stats_register(type_index, thread_counters_type::counters);
+
+    thread_counters_type::is_registered = true;
+  }
+
+  // Record a sampled call.
+  template<typename Params, typename EngineType>
+  CRC_CATALOG_STATS_NOINLINE typename EngineType::value_type crc_stats_update_sampled(const typename EngineType::value_type crc,
+                                                                                      const std::uint8_t*                   message,
+                                                                                      const std::size_t                     count)
+  {
+    using thread_counters_type = crc_stats_thread_counters<Params, EngineType>;
+
+    crc_stats_thread_countdown() = crc_stats_sample_interval();
+
+    if(thread_counters_type::is_registered == false)
+    {
+      crc_stats_register_thread_counters<Params, EngineType>();
+    }
+
+    crc_stats_type_counters& counters = thread_counters_type::counters;
+
+    if(count < crc_stats_exact_size_count)
+    {
+      counters.exact_sizes[count].add(1U);
+
+      return EngineType::update(crc, message, count);
+    }
+
+    return (crc_stats_count_long(counters, count) ? crc_stats_update_timed<EngineType>(counters, crc, message, count)
+                                                  : EngineType::update(crc, message, count));
+  }
+
+  template<typename Params, typename EngineType>
+  typename EngineType::value_type crc_stats_update(const typename EngineType::value_type crc,
+                                                   const std::uint8_t*                   message,
+                                                   const std::size_t                     count)
+  {
+    return ((--crc_stats_thread_countdown() != 0U) ? EngineType::update(crc, message, count)
+                                                   : crc_stats_update_sampled<Params, EngineType>(crc, message, count));
+  }
+
+  #endif // CRC_CATALOG_ENABLE_STATS
+
+  // The update of a register by the engine of an algorithm. With
+  // CRC_CATALOG_ENABLE_STATS, calls made at runtime are counted.
+
+  template<typename Params, typename EngineType>
+  CRC_CATALOG_CONSTEXPR typename EngineType::value_type crc_engine_update(const typename EngineType::value_type crc,
+                                                                          const std::uint8_t*                   message,
+                                                                          const std::size_t                     count)
+  {
+    #if defined(CRC_CATALOG_ENABLE_STATS)
+    if(!CRC_CATALOG_IS_CONSTANT_EVALUATED())
+    {
+      return crc_stats_update<Params, EngineType>(crc, message, count);
+    }
+    #endif
+
+    return EngineType::update(crc, message, count);
+  }
+
+  // Polynomial arithmetic modulo P for combining CRCs. Values are
+  // NumberOfBits-bit polynomials in normal (non-reflected) orientation.
+
+  template<typename UnsignedIntegralType>
+  struct crc_power_array
+  {
+    UnsignedIntegralType values[64U];
+  };
+
+  template<const std::size_t NumberOfBits,
+           const crc_value_type<NumberOfBits> Polynomial>
+  struct crc_polynomial_math
+  {
+    using value_type = crc_value_type<NumberOfBits>;
+
+    static constexpr value_type times_x(const value_type& value)
+    {
+      return value_type(value_type(value_type(value << 1) ^ ((value_type(value & top_bit) != 0U) ? Polynomial : value_type(0U))) & value_mask);
+    }
+
+    static constexpr value_type multiply(const value_type& a, const value_type& b)
+    {
+      // Compute a * b mod P, scanning the bits of a from the highest.
+      value_type product(0U);
+
+      for(std::size_t i = NumberOfBits; i > 0U; --i)
+      {
+        product = times_x(product);
+
+        if(value_type(value_type(a >> (i - 1U)) & 1U) != 0U)
+        {
+          product = value_type(product ^ b);
+        }
+      }
+
+      return product;
+    }
+
+    static constexpr crc_power_array<value_type> make_byte_powers()
+    {
+      // The powers x^(8 * 2^k) mod P, for shifting over 2^k bytes.
+      crc_power_array<value_type> powers { };
+
+      value_type x_to_the_8(1U);
+
+      for(std::size_t i = 0U; i < 8U; ++i)
+      {
+        x_to_the_8 = times_x(x_to_the_8);
+      }
+
+      powers.values[0U] = x_to_the_8;
+
+      for(std::size_t k = 1U; k < 64U; ++k)
+      {
+        powers.values[k] = multiply(powers.values[k - 1U], powers.values[k - 1U]);
+      }
+
+      return powers;
+    }
+
+  private:
+    static constexpr value_type top_bit = value_type(value_type(1U) << (NumberOfBits - 1U));
+
+    static constexpr value_type value_mask =
+      value_type((std::numeric_limits<value_type>::max)() >> (std::numeric_limits<value_type>::digits - NumberOfBits));
+  };
+
+  template<const std::size_t NumberOfBits,
+           const crc_value_type<NumberOfBits> Polynomial>
+  struct crc_byte_shift
+  {
+    using value_type = crc_value_type<NumberOfBits>;
+    using math_type  = crc_polynomial_math<NumberOfBits, Polynomial>;
+
+    static constexpr crc_power_array<value_type> byte_powers = math_type::make_byte_powers();
+
+    static constexpr value_type shift_bytes(value_type value, std::uint64_t byte_count)
+    {
+      // Multiply with x^(8 * byte_count) mod P, using one table
+      // entry for each bit set in the byte count.
+      for(std::size_t k = 0U; byte_count != 0U; ++k, byte_count >>= 1)
+      {
+        if((byte_count & 1U) != 0U)
+        {
+          value = math_type::multiply(value, byte_powers.values[k]);
+        }
+      }
+
+      return value;
+    }
+  };
+
+  template<const std::size_t NumberOfBits,
+           const crc_value_type<NumberOfBits> Polynomial>
+  constexpr crc_power_array<crc_value_type<NumberOfBits>> crc_byte_shift<NumberOfBits, Polynomial>::byte_powers;
+
+  // The batch engine computes the registers of many independent messages.
+  // The engine is selected once per batch. With carry-less multiplication,
+  // all messages of at least 16 bytes are folded one after the other.
+  // Otherwise, messages having at least three slicing steps are taken in
+  // groups of four lanes, which the slicing engine processes in lock-step
+  // up to the shortest length of the group. The steps of different lanes
+  // do not depend on each other, so that their table lookups are issued
+  // together instead of waiting for the previous step of the same message.
+  // The remaining bytes of the lanes, the messages left over at the end
+  // and the shorter messages (for which grouping costs more than it saves)
+  // are completed one at a time.
+
+  template<const std::size_t NumberOfBits,
+           const crc_value_type<NumberOfBits> Polynomial,
+           const bool ReflectIn>
+  struct crc_batch_engine
+  {
+    using value_type = crc_value_type<NumberOfBits>;
+
+    static constexpr std::size_t lane_count = 4U;
+
+    static void compute(const std::uint8_t* const* messages,
+                        const std::size_t*         counts,
+                        const std::size_t          message_count,
+                        value_type*                registers,
+                        const value_type&          initial_register)
+    {
+      #if defined(CRC_CATALOG_HAS_CLMUL)
+      using clmul_type = crc_clmul<NumberOfBits, Polynomial, ReflectIn>;
+
+      const bool clmul_is_supported = crc_clmul_is_supported();
+      #endif
+
+      // The indices of the messages waiting for a full group of lanes.
+      std::size_t lanes[lane_count];
+
+      std::size_t lane_index = 0U;
+
+      for(std::size_t index = 0U; index < message_count; ++index)
+      {
+        #if defined(CRC_CATALOG_HAS_CLMUL)
+        if(clmul_is_supported && (counts[index] >= clmul_type::minimum_count))
+        {
+          registers[index] = clmul_type::update(initial_register, messages[index], counts[index]);
+        }
+        else
+        #endif
+        if(counts[index] < lane_minimum_count)
+        {
+          registers[index] = slicing_type::update(initial_register, messages[index], counts[index]);
+        }
+        else
+        {
+          lanes[lane_index] = index;
+
+          if(++lane_index == lane_count)
+          {
+            update_lanes(messages, counts, lanes, registers, initial_register, std::make_index_sequence<lane_count>());
+
+            lane_index = 0U;
+          }
+        }
+      }
+
+      for(std::size_t index = 0U; index < lane_index; ++index)
+      {
+        registers[lanes[index]] = slicing_type::update(initial_register, messages[lanes[index]], counts[lanes[index]]);
+      }
+    }
+
+  private:
+    using slicing_type = crc_slicing_table<NumberOfBits, Polynomial, ReflectIn, CRC_CATALOG_SLICE_COUNT>;
+
+    static constexpr std::size_t step_count = CRC_CATALOG_SLICE_COUNT;
+
+    static constexpr std::size_t lane_minimum_count = 3U * step_count;
+
+    template<const std::size_t... LaneIndex>
+    static void update_lanes(const std::uint8_t* const* messages,
+                             const std::size_t*         counts,
+                             const std::size_t*         lanes,
+                             value_type*                registers,
+                             const value_type&          initial_register,
+                             std::index_sequence<LaneIndex...>)
+    {
+      using expander_type = int[];
+
+      // The number of bytes processed in lock-step, in whole steps.
+      std::size_t common_count = counts[lanes[0U]];
+
+      for(std::size_t index = 1U; index < lane_count; ++index)
+      {
+        common_count = ((counts[lanes[index]] < common_count) ? counts[lanes[index]] : common_count);
+      }
+
+      common_count -= (common_count % step_count);
+
+      value_type lane_registers[lane_count];
+
+      static_cast<void>(expander_type { 0, ((lane_registers[LaneIndex] = initial_register), 0)... });
+
+      for(std::size_t offset = 0U; offset < common_count; offset += step_count)
+      {
+        static_cast<void>(expander_type { 0, ((lane_registers[LaneIndex] = slicing_type::update(lane_registers[LaneIndex], messages[lanes[LaneIndex]] + offset, step_count)), 0)... });
+      }
+
+      static_cast<void>(expander_type { 0, ((registers[lanes[LaneIndex]] = slicing_type::update(lane_registers[LaneIndex], messages[lanes[LaneIndex]] + common_count, counts[lanes[LaneIndex]] - common_count)), 0)... });
+    }
+  };
+
+  } // namespace crc::catalog::detail
+
+  template<const std::size_t NumberOfBits,
+           typename UnsignedIntegralType = typename detail::uint_type_helper<NumberOfBits>::exact_unsigned_type>
+  constexpr UnsignedIntegralType crc_bitwise_template(const std::uint8_t*         message,
+                                                      const std::size_t           count,
+                                                      const UnsignedIntegralType& polynomial,
+                                                      const UnsignedIntegralType& initial_value,
+                                                      const UnsignedIntegralType& final_xor_value,
+                                                      const bool                  reflect_in,
+                                                      const bool                  reflect_out)
+  {
+    using value_type = UnsignedIntegralType;
+
+    // The data_type is fixed to exactly 8-bits in width at the moment.
+    using data_type = std::uint8_t;
+
+    static_assert(std::numeric_limits<std::uint8_t>::digits == 8,
+                  "Error: The data_type (at the moment) must have exactly 8 bits.");
+
+    value_type crc =
+      initial_value << (std::size_t(std::numeric_limits<value_type>::digits) - NumberOfBits);
+
+    // Perform the polynomial division, one element at a time.
+    for(std::size_t data_index = 0U; data_index < count; ++data_index)
+    {
+      // Obtain the next data element (and reflect it if necessary).
+      const data_type next_data_element =
+        ((reflect_in == false)
+          ? message[data_index]
+          : detail::crc_reflect_template<std::size_t(std::numeric_limits<data_type>::digits)>(message[data_index]));
+
+      {
+        const std::size_t left_shift_amount =
+          std::size_t(  std::numeric_limits<value_type>::digits
+                      - std::numeric_limits<data_type >::digits);
+
+        crc ^= value_type(value_type(next_data_element) << left_shift_amount);
+      }
+
+      // Process the next data byte, one bit at a time.
+      for(std::uint_fast8_t bit_index = 0U; bit_index < std::uint_fast8_t(std::numeric_limits<data_type>::digits); ++bit_index)
+      {
+        const bool high_bit_of_crc_is_set =
+          (value_type(crc & value_type(std::uintmax_t(1ULL) << (std::numeric_limits<value_type>::digits - 1))) != 0U);
+
+        crc <<= 1;
+
+        if(high_bit_of_crc_is_set)
+        {
+          // Shift through the polynomial. Also left-justify the
+          // polynomial within the width of value_type, if necessary.
+          const std::size_t left_shift_amount =
+            std::size_t(std::size_t(std::numeric_limits<value_type>::digits) - NumberOfBits);
+
+          crc ^= value_type(polynomial << left_shift_amount);
+        }
+      }
+    }
+
+    // Downshift the result to compensate for a potential
+    // left-justification of the polynomial in the loop above.
+    {
+      const std::size_t right_shift_amount =
+        std::size_t(std::size_t(std::numeric_limits<value_type>::digits) - NumberOfBits);
+
+      crc >>= right_shift_amount;
+    }
+
+    if(reflect_out == true)
+    {
+      // Reflect the output result if necessary.
+      crc = detail::crc_reflect_template<NumberOfBits>(crc);
+    }
+
+    // Perform the final XOR on the result.
+    crc ^= final_xor_value;
+
+    return crc;
+  }
+
+  template<const std::size_t NumberOfBits,
+           const detail::crc_value_type<NumberOfBits> Polynomial,
+           const bool ReflectIn>
+  constexpr detail::crc_value_type<NumberOfBits> crc_table_template(const std::uint8_t*                         message,
+                                                                    const std::size_t                           count,
+                                                                    const detail::crc_value_type<NumberOfBits>& initial_value,
+                                                                    const detail::crc_value_type<NumberOfBits>& final_xor_value,
+                                                                    const bool                                  reflect_out)
+  {
+    // This is the table-driven, byte-at-a-time counterpart of crc_bitwise_template.
+    // The 256-entry lookup table for (NumberOfBits, Polynomial, ReflectIn)
+    // is generated at compile time. The bitwise template remains the reference.
+
+    using table_type = detail::crc_table<NumberOfBits, Polynomial, ReflectIn>;
+
+    const detail::crc_value_type<NumberOfBits> crc =
+      table_type::update(detail::crc_register_initialize<NumberOfBits, ReflectIn>(initial_value), message, count);
+
+    return detail::crc_register_finalize<NumberOfBits, ReflectIn>(crc, final_xor_value, reflect_out);
+  }
+
+  template<const std::size_t NumberOfBits,
+           const detail::crc_value_type<NumberOfBits> Polynomial,
+           const bool ReflectIn,
+           const std::size_t SliceCount = CRC_CATALOG_SLICE_COUNT>
+  constexpr detail::crc_value_type<NumberOfBits> crc_slicing_template(const std::uint8_t*                         message,
+                                                                      const std::size_t                           count,
+                                                                      const detail::crc_value_type<NumberOfBits>& initial_value,
+                                                                      const detail::crc_value_type<NumberOfBits>& final_xor_value,
+                                                                      const bool                                  reflect_out)
+  {
+    // This is the slicing-by-N engine, processing SliceCount bytes per step.
+    // It uses SliceCount lookup tables generated at compile time. Builds
+    // with tight memory constraints can select a smaller SliceCount.
+
+    using table_type = detail::crc_slicing_table<NumberOfBits, Polynomial, ReflectIn, SliceCount>;
+
+    const detail::crc_value_type<NumberOfBits> crc =
+      table_type::update(detail::crc_register_initialize<NumberOfBits, ReflectIn>(initial_value), message, count);
+
+    return detail::crc_register_finalize<NumberOfBits, ReflectIn>(crc, final_xor_value, reflect_out);
+  }
+
+  template<const std::size_t NumberOfBits,
+           const detail::crc_value_type<NumberOfBits> Polynomial,
+           const bool ReflectIn>
+  detail::crc_value_type<NumberOfBits> crc_clmul_template(const std::uint8_t*                         message,
+                                                          const std::size_t                           count,
+                                                          const detail::crc_value_type<NumberOfBits>& initial_value,
+                                                          const detail::crc_value_type<NumberOfBits>& final_xor_value,
+                                                          const bool                                  reflect_out)
+  {
+    // This is the carry-less multiplication folding engine (x86-64 PCLMULQDQ)
+    // for any CRC up to 64 bits. It falls back to the portable engine
+    // if the CPU lacks PCLMULQDQ or if the message is too short to fold.
+
+    detail::crc_value_type<NumberOfBits> crc = detail::crc_register_initialize<NumberOfBits, ReflectIn>(initial_value);
+
+    #if defined(CRC_CATALOG_HAS_CLMUL)
+    if((count >= detail::crc_clmul<NumberOfBits, Polynomial, ReflectIn>::minimum_count) && detail::crc_clmul_is_supported())
+    {
+      crc = detail::crc_clmul<NumberOfBits, Polynomial, ReflectIn>::update(crc, message, count);
+    }
+    else
+    #endif
+    {
+      crc = detail::crc_portable_engine<NumberOfBits, Polynomial, ReflectIn>::update(crc, message, count);
+    }
+
+    return detail::crc_register_finalize<NumberOfBits, ReflectIn>(crc, final_xor_value, reflect_out);
+  }
+
+  template<const std::size_t NumberOfBits,
+           const detail::crc_value_type<NumberOfBits> Polynomial,
+           const bool ReflectIn>
+  CRC_CATALOG_CONSTEXPR detail::crc_value_type<NumberOfBits> crc_default_template(const std::uint8_t*                         message,
+                                                                                  const std::size_t                           count,
+                                                                                  const detail::crc_value_type<NumberOfBits>& initial_value,
+                                                                                  const detail::crc_value_type<NumberOfBits>& final_xor_value,
+                                                                                  const bool                                  reflect_out)
+  {
+    // This is the engine used by the named CRCs. It selects carry-less
+    // multiplication folding for long messages on CPUs supporting it,
+    // and otherwise the slicing engine (or the byte-at-a-time table
+    // engine for CRCs having up to 8 bits). During constant evaluation
+    // it always uses the portable engine.
+
+    using engine_type = detail::crc_default_engine<NumberOfBits, Polynomial, ReflectIn>;
+
+    const detail::crc_value_type<NumberOfBits> crc =
+      engine_type::update(detail::crc_register_initialize<NumberOfBits, ReflectIn>(initial_value), message, count);
+
+    return detail::crc_register_finalize<NumberOfBits, ReflectIn>(crc, final_xor_value, reflect_out);
+  }
+
+
+  // The parameters of a CRC algorithm in the catalog. The check value
+  // is the CRC of the ASCII string "123456789". The residue is the raw
+  // register (before the final XOR) after checksumming a message followed
+  // by its own CRC. Each algorithm of the catalog is a type derived from
+  // crc_params which also provides its catalog name via name(). Further
+  // algorithms can be added by declaring such a type.
+
+  template<const std::size_t NumberOfBits,
+           const detail::crc_value_type<NumberOfBits> Polynomial,
+           const detail::crc_value_type<NumberOfBits> InitialValue,
+           const detail::crc_value_type<NumberOfBits> FinalXorValue,
+           const bool ReflectIn,
+           const bool ReflectOut,
+           const detail::crc_value_type<NumberOfBits> Check   = 0U,
+           const detail::crc_value_type<NumberOfBits> Residue = 0U>
+  struct crc_params
+  {
+    using value_type = detail::crc_value_type<NumberOfBits>;
+
+    static constexpr std::size_t number_of_bits  = NumberOfBits;
+    static constexpr value_type  polynomial      = Polynomial;
+    static constexpr value_type  initial_value   = InitialValue;
+    static constexpr value_type  final_xor_value = FinalXorValue;
+    static constexpr bool        reflect_in      = ReflectIn;
+    static constexpr bool        reflect_out     = ReflectOut;
+    static constexpr value_type  check           = Check;
+    static constexpr value_type  residue         = Residue;
+  };
+
+  template<const std::size_t NumberOfBits, const detail::crc_value_type<NumberOfBits> Polynomial, const detail::crc_value_type<NumberOfBits> InitialValue, const detail::crc_value_type<NumberOfBits> FinalXorValue, const bool ReflectIn, const bool ReflectOut, const detail::crc_value_type<NumberOfBits> Check, const detail::crc_value_type<NumberOfBits> Residue>
+  constexpr std::size_t crc_params<NumberOfBits, Polynomial, InitialValue, FinalXorValue, ReflectIn, ReflectOut, Check, Residue>::number_of_bits;
+
+  template<const std::size_t NumberOfBits, const detail::crc_value_type<NumberOfBits> Polynomial, const detail::crc_value_type<NumberOfBits> InitialValue, const detail::crc_value_type<NumberOfBits> FinalXorValue, const bool ReflectIn, const bool ReflectOut, const detail::crc_value_type<NumberOfBits> Check, const detail::crc_value_type<NumberOfBits> Residue>
+  constexpr detail::crc_value_type<NumberOfBits> crc_params<NumberOfBits, Polynomial, InitialValue, FinalXorValue, ReflectIn, ReflectOut, Check, Residue>::polynomial;
+
+  template<const std::size_t NumberOfBits, const detail::crc_value_type<NumberOfBits> Polynomial, const detail::crc_value_type<NumberOfBits> InitialValue, const detail::crc_value_type<NumberOfBits> FinalXorValue, const bool ReflectIn, const bool ReflectOut, const detail::crc_value_type<NumberOfBits> Check, const detail::crc_value_type<NumberOfBits> Residue>
+  constexpr detail::crc_value_type<NumberOfBits> crc_params<NumberOfBits, Polynomial, InitialValue, FinalXorValue, ReflectIn, ReflectOut, Check, Residue>::initial_value;
+
+  template<const std::size_t NumberOfBits, const detail::crc_value_type<NumberOfBits> Polynomial, const detail::crc_value_type<NumberOfBits> InitialValue, const detail::crc_value_type<NumberOfBits> FinalXorValue, const bool ReflectIn, const bool ReflectOut, const detail::crc_value_type<NumberOfBits> Check, const detail::crc_value_type<NumberOfBits> Residue>
+  constexpr detail::crc_value_type<NumberOfBits> crc_params<NumberOfBits, Polynomial, InitialValue, FinalXorValue, ReflectIn, ReflectOut, Check, Residue>::final_xor_value;
+
+  template<const std::size_t NumberOfBits, const detail::crc_value_type<NumberOfBits> Polynomial, const detail::crc_value_type<NumberOfBits> InitialValue, const detail::crc_value_type<NumberOfBits> FinalXorValue, const bool ReflectIn, const bool ReflectOut, const detail::crc_value_type<NumberOfBits> Check, const detail::crc_value_type<NumberOfBits> Residue>
+  constexpr bool crc_params<NumberOfBits, Polynomial, InitialValue, FinalXorValue, ReflectIn, ReflectOut, Check, Residue>::reflect_in;
+
+  template<const std::size_t NumberOfBits, const detail::crc_value_type<NumberOfBits> Polynomial, const detail::crc_value_type<NumberOfBits> InitialValue, const detail::crc_value_type<NumberOfBits> FinalXorValue, const bool ReflectIn, const bool ReflectOut, const detail::crc_value_type<NumberOfBits> Check, const detail::crc_value_type<NumberOfBits> Residue>
+  constexpr bool crc_params<NumberOfBits, Polynomial, InitialValue, FinalXorValue, ReflectIn, ReflectOut, Check, Residue>::reflect_out;
+
+  template<const std::size_t NumberOfBits, const detail::crc_value_type<NumberOfBits> Polynomial, const detail::crc_value_type<NumberOfBits> InitialValue, const detail::crc_value_type<NumberOfBits> FinalXorValue, const bool ReflectIn, const bool ReflectOut, const detail::crc_value_type<NumberOfBits> Check, const detail::crc_value_type<NumberOfBits> Residue>
+  constexpr detail::crc_value_type<NumberOfBits> crc_params<NumberOfBits, Polynomial, InitialValue, FinalXorValue, ReflectIn, ReflectOut, Check, Residue>::check;
+
+  template<const std::size_t NumberOfBits, const detail::crc_value_type<NumberOfBits> Polynomial, const detail::crc_value_type<NumberOfBits> InitialValue, const detail::crc_value_type<NumberOfBits> FinalXorValue, const bool ReflectIn, const bool ReflectOut, const detail::crc_value_type<NumberOfBits> Check, const detail::crc_value_type<NumberOfBits> Residue>
+  constexpr detail::crc_value_type<NumberOfBits> crc_params<NumberOfBits, Polynomial, InitialValue, FinalXorValue, ReflectIn, ReflectOut, Check, Residue>::residue;
+
+  // The engine policies select the engine used by crc_engine. Each one
+  // provides the engine type for a given parameter type. All engines are
+  // fully specialized for the width, polynomial and input reflection.
+
+  // One bit at a time, without a lookup table (the smallest footprint).
+  struct crc_bitwise_policy
+  {
+    template<typename Params>
+    using engine_type = detail::crc_bitwise<Params::number_of_bits, Params::polynomial, Params::reflect_in>;
+  };
+
+  // One byte at a time with a 256-entry lookup table.
+  struct crc_table_policy
+  {
+    template<typename Params>
+    using engine_type = detail::crc_table<Params::number_of_bits, Params::polynomial, Params::reflect_in>;
+  };
+
+  // One nibble at a time with a 16-entry lookup table.
+  struct crc_nibble_policy
+  {
+    template<typename Params>
+    using engine_type = detail::crc_nibble_table<Params::number_of_bits, Params::polynomial, Params::reflect_in>;
+  };
+
+  // One byte at a time with a pair of 16-entry lookup tables.
+  struct crc_nibble_pair_policy
+  {
+    template<typename Params>
+    using engine_type = detail::crc_nibble_pair<Params::number_of_bits, Params::polynomial, Params::reflect_in>;
+  };
+
+  // SliceCount bytes at a time with SliceCount lookup tables.
+  template<const std::size_t SliceCount = CRC_CATALOG_SLICE_COUNT>
+  struct crc_slicing_policy
+  {
+    template<typename Params>
+    using engine_type = detail::crc_slicing_table<Params::number_of_bits, Params::polynomial, Params::reflect_in, SliceCount>;
+  };
+
+  // Carry-less multiplication folding where supported, otherwise portable.
+  struct crc_clmul_policy
+  {
+    template<typename Params>
+    using engine_type = detail::crc_generic_engine<Params::number_of_bits, Params::polynomial, Params::reflect_in>;
+  };
+
+  // The engine of the named CRCs, which also uses the CRC32C instructions.
+  struct crc_default_policy
+  {
+    template<typename Params>
+    using engine_type = detail::crc_default_engine<Params::number_of_bits, Params::polynomial, Params::reflect_in>;
+  };
+
+  // Incremental CRC computation for messages arriving in pieces.
+  // The raw register is kept between the calls of update(), and the
+  // initial value, output reflection and final XOR are only applied
+  // by init() and finalize(). The result of finalize() equals the
+  // one-shot CRC of the concatenated pieces. finalize() does not
+  // modify the state, so the computation can continue afterwards.
+  // All of this can be used in constant expressions, see the
+  // description of CRC_CATALOG_CONSTEXPR above. The engine policy
+  // selects the engine, see crc_default_policy and the ones above it.
+
+  template<typename Params,
+           typename EnginePolicy = crc_default_policy>
+  class crc_engine
+  {
+  public:
+    using params_type = Params;
+    using policy_type = EnginePolicy;
+    using value_type  = typename params_type::value_type;
+
+    constexpr crc_engine() : my_register(initial_register) { }
+
+    // The memory of the lookup tables used by the engine in bytes.
+    static constexpr std::size_t table_size() { return engine_type::table_size(); }
+
+    CRC_CATALOG_CONSTEXPR void init() { my_register = initial_register; }
+
+    CRC_CATALOG_CONSTEXPR void reset() { init(); }
+
+    CRC_CATALOG_CONSTEXPR crc_engine& update(const std::uint8_t* message, const std::size_t count)
+    {
+      my_register = detail::crc_engine_update<params_type, engine_type>(my_register, message, count);
+
+      return *this;
+    }
+
+    // Update with a message of any number of bits. The whole bytes are
+    // processed by the engine and the remaining 1 to 7 bits, taken from
+    // the following byte in the order given by the input reflection
+    // (starting with its most significant bit without input reflection),
+    // are processed one by one.
+    CRC_CATALOG_CONSTEXPR crc_engine& update_bits(const std::uint8_t* message, const std::size_t bits)
+    {
+      my_register = update_bits_register(my_register, message, bits);
+
+      return *this;
+    }
+
+    constexpr value_type finalize() const
+    {
+      return finalize_register(my_register);
+    }
+
+    static CRC_CATALOG_CONSTEXPR value_type checksum(const std::uint8_t* message, const std::size_t count)
+    {
+      return finalize_register(detail::crc_engine_update<params_type, engine_type>(initial_register, message, count));
+    }
+
+    static CRC_CATALOG_CONSTEXPR value_type checksum_bits(const std::uint8_t* message, const std::size_t bits)
+    {
+      return finalize_register(update_bits_register(initial_register, message, bits));
+    }
+
+    // The CRC of a char array. A terminating null character (as the one
+    // of a string literal) is excluded, and all characters of an array
+    // not ending with one are included.
+    template<const std::size_t N>
+    static CRC_CATALOG_CONSTEXPR value_type checksum(const char (&text)[N])
+    {
+      // A char pointer can not be reinterpreted as a byte pointer
+      // in a constant expression, so constant evaluation reads the
+      // characters one by one with the byte-at-a-time table.
+      using table_type = detail::crc_table<params_type::number_of_bits,
+                                           params_type::polynomial,
+                                           params_type::reflect_in>;
+
+      const std::size_t count = ((text[N - 1U] == '\0') ? (N - 1U) : N);
+
+      return (CRC_CATALOG_IS_CONSTANT_EVALUATED()
+               ? finalize_register(table_type::update(initial_register, text, count))
+               : checksum(reinterpret_cast<const std::uint8_t*>(text), count));
+    }
+
+    template<const std::size_t N>
+    static CRC_CATALOG_CONSTEXPR value_type checksum(const std::array<std::uint8_t, N>& data)
+    {
+      return ((N == 0U) ? checksum(nullptr, 0U) : checksum(&data[0U], N));
+    }
+
+  private:
+    using engine_type = typename policy_type::template engine_type<params_type>;
+
+    static constexpr value_type initial_register =
+      detail::crc_register_initialize<params_type::number_of_bits, params_type::reflect_in>(params_type::initial_value);
+
+    value_type my_register;
+
+    static CRC_CATALOG_CONSTEXPR value_type update_bits_register(const value_type& crc, const std::uint8_t* message, const std::size_t bits)
+    {
+      using bitwise_type = detail::crc_bitwise<params_type::number_of_bits,
+                                               params_type::polynomial,
+                                               params_type::reflect_in>;
+
+      const std::size_t count = bits / 8U;
+
+      const value_type crc_of_bytes = detail::crc_engine_update<params_type, engine_type>(crc, message, count);
+
+      return (((bits % 8U) == 0U) ? crc_of_bytes : bitwise_type::update_bits(crc_of_bytes, message[count], bits % 8U));
+    }
+
+    static constexpr value_type finalize_register(const value_type& crc)
+    {
+      return detail::crc_register_finalize<params_type::number_of_bits, params_type::reflect_in>(crc,
+                                                                                                 params_type::final_xor_value,
+                                                                                                 params_type::reflect_out);
+    }
+  };
+
+  template<typename Params, typename EnginePolicy>
+  constexpr typename crc_engine<Params, EnginePolicy>::value_type crc_engine<Params, EnginePolicy>::initial_register;
+
+  // Combine the CRCs of two messages A and B into the CRC of the
+  // concatenation A||B, given only the length of B in bytes. This needs
+  // O(log(length_b)) polynomial multiplications and no pass over the data.
+  // Since the register update is linear, reg(A||B) = reg(A) * x^(8 * length_b)
+  // + reg(B) + init * x^(8 * length_b) (mod P), where the last term cancels
+  // the initial value contained in reg(B).
+
+  template<typename Params>
+  constexpr typename Params::value_type crc_combine(const typename Params::value_type& crc_a,
+                                                    const typename Params::value_type& crc_b,
+                                                    const std::uint64_t                length_b)
+  {
+    using value_type = typename Params::value_type;
+    using shift_type = detail::crc_byte_shift<Params::number_of_bits, Params::polynomial>;
+
+    // Recover the registers (in normal orientation) from the CRC values.
+    const value_type register_a = value_type(crc_a ^ Params::final_xor_value);
+    const value_type register_b = value_type(crc_b ^ Params::final_xor_value);
+
+    const value_type normal_a = (Params::reflect_out ? detail::crc_reflect_template<Params::number_of_bits, value_type>(register_a) : register_a);
+    const value_type normal_b = (Params::reflect_out ? detail::crc_reflect_template<Params::number_of_bits, value_type>(register_b) : register_b);
+
+    const value_type normal_ab =
+      value_type(shift_type::shift_bytes(value_type(normal_a ^ Params::initial_value), length_b) ^ normal_b);
+
+    const value_type register_ab = (Params::reflect_out ? detail::crc_reflect_template<Params::number_of_bits, value_type>(normal_ab) : normal_ab);
+
+    return value_type(register_ab ^ Params::final_xor_value);
+  }
+
+  // Update the CRC of a message of length bytes after count bytes at
+  // offset have been changed in place from old_bytes to new_bytes,
+  // without another pass over the message. This needs O(count) steps of
+  // the engine and O(log(length)) polynomial multiplications. Since the
+  // register update is linear, the initial value and the final XOR value
+  // cancel in CRC(M) ^ CRC(M'), which is the CRC with zero initial and
+  // final XOR values of the difference of the bytes followed by the
+  // length - (offset + count) unchanged bytes (leading zero bytes leave
+  // a zero register unchanged). The zero bytes following the difference
+  // are applied with a multiplication by x^(8 * (length - offset - count)).
+
+  template<typename Params,
+           typename EnginePolicy = crc_default_policy>
+  typename Params::value_type crc_patch(const typename Params::value_type& crc,
+                                        const std::uint64_t                length,
+                                        const std::uint64_t                offset,
+                                        const std::uint8_t*                old_bytes,
+                                        const std::uint8_t*                new_bytes,
+                                        const std::size_t                  count)
+  {
+    using value_type  = typename Params::value_type;
+    using engine_type = typename EnginePolicy::template engine_type<Params>;
+    using shift_type  = detail::crc_byte_shift<Params::number_of_bits, Params::polynomial>;
+
+    // The register of the difference, computed in blocks on the stack.
+    value_type difference_register = 0U;
+
+    std::uint8_t difference[64U];
+
+    for(std::size_t index = 0U; index < count; index += sizeof(difference))
+    {
+      const std::size_t block_count = (((count - index) < sizeof(difference)) ? (count - index) : sizeof(difference));
+
+      for(std::size_t block_index = 0U; block_index < block_count; ++block_index)
+      {
+        difference[block_index] = std::uint8_t(old_bytes[index + block_index] ^ new_bytes[index + block_index]);
+      }
+
+      difference_register = engine_type::update(difference_register, difference, block_count);
+    }
+
+    // The difference in normal orientation, shifted over the bytes after it.
+    const value_type difference_crc =
+      detail::crc_register_finalize<Params::number_of_bits, Params::reflect_in>(difference_register, value_type(0U), Params::reflect_out);
+
+    const value_type normal_difference =
+      (Params::reflect_out ? detail::crc_reflect_template<Params::number_of_bits, value_type>(difference_crc) : difference_crc);
+
+    const value_type normal_shifted = shift_type::shift_bytes(normal_difference, length - (offset + count));
+
+    const value_type shifted_crc =
+      (Params::reflect_out ? detail::crc_reflect_template<Params::number_of_bits, value_type>(normal_shifted) : normal_shifted);
+
+    return value_type(crc ^ shifted_crc);
+  }
+
+  // A CRC appended to a message (for instance a frame or a record) is
+  // stored in crc_field_size<Params>() bytes, least significant byte first
+  // for algorithms with output reflection and most significant byte first
+  // otherwise. crc_append writes the CRC of the count bytes of the message
+  // to the bytes following them, and crc_verify checks a message of count
+  // bytes including its trailing CRC.
+  //
+  // For widths that are a multiple of 8 and equal input and output
+  // reflection, this is the byte order in which the register leaves the
+  // message, so the CRC of the whole message is a constant determined by
+  // the residue of the algorithm. crc_verify then makes one pass over the
+  // message and the CRC, and compares the result with the residue given
+  // by the parameter type. Otherwise the CRC of the message without the
+  // field is compared with the field. This is selected at compile time.
+
+  template<typename Params>
+  constexpr std::size_t crc_field_size()
+  {
+    return std::size_t((Params::number_of_bits + 7U) / 8U);
+  }
+
+  namespace detail {
+
+  template<typename Params>
+  void crc_field_write(const typename Params::value_type& crc, std::uint8_t* field)
+  {
+    for(std::size_t index = 0U; index < crc_field_size<Params>(); ++index)
+    {
+      const std::size_t shift = 8U * (Params::reflect_out ? index : ((crc_field_size<Params>() - 1U) - index));
+
+      field[index] = std::uint8_t(std::uint64_t(crc) >> shift);
+    }
+  }
+
+  template<typename Params>
+  typename Params::value_type crc_field_read(const std::uint8_t* field)
+  {
+    std::uint64_t crc = 0U;
+
+    for(std::size_t index = 0U; index < crc_field_size<Params>(); ++index)
+    {
+      const std::size_t shift = 8U * (Params::reflect_out ? index : ((crc_field_size<Params>() - 1U) - index));
+
+      crc |= std::uint64_t(std::uint64_t(field[index]) << shift);
+    }
+
+    return typename Params::value_type(crc);
+  }
+
+  template<typename Params>
+  struct crc_field_has_residue
+  {
+    static constexpr bool value = (((Params::number_of_bits % 8U) == 0U) && (Params::reflect_in == Params::reflect_out));
+  };
+
+  template<typename Params,
+           typename EnginePolicy>
+  bool crc_verify(const std::uint8_t* message, const std::size_t count, std::true_type)
+  {
+    using value_type = typename Params::value_type;
+
+    return (crc_engine<Params, EnginePolicy>::checksum(message, count) == value_type(Params::residue ^ Params::final_xor_value));
+  }
+
+  template<typename Params,
+           typename EnginePolicy>
+  bool crc_verify(const std::uint8_t* message, const std::size_t count, std::false_type)
+  {
+    const std::size_t message_count = count - crc_field_size<Params>();
+
+    return (crc_engine<Params, EnginePolicy>::checksum(message, message_count) == crc_field_read<Params>(message + message_count));
+  }
+
+  } // namespace crc::catalog::detail
+
+  template<typename Params,
+           typename EnginePolicy = crc_default_policy>
+  typename Params::value_type crc_append(std::uint8_t* message, const std::size_t count)
+  {
+    const typename Params::value_type crc = crc_engine<Params, EnginePolicy>::checksum(message, count);
+
+    detail::crc_field_write<Params>(crc, message + count);
+
+    return crc;
+  }
+
+  template<typename Params,
+           typename EnginePolicy = crc_default_policy>
+  bool crc_verify(const std::uint8_t* message, const std::size_t count)
+  {
+    using has_residue_type = std::integral_constant<bool, detail::crc_field_has_residue<Params>::value>;
+
+    return ((count >= crc_field_size<Params>()) && detail::crc_verify<Params, EnginePolicy>(message, count, has_residue_type()));
+  }
+
+  // Compute the CRCs of many (typically short) messages in one call.
+  // The CRC of the message at messages[i] having counts[i] bytes is
+  // stored in results[i].
+
+  template<typename Params>
+  void crc_batch(const std::uint8_t* const*   messages,
+                 const std::size_t*           counts,
+                 const std::size_t            message_count,
+                 typename Params::value_type* results)
+  {
+    using batch_type = detail::crc_batch_engine<Params::number_of_bits, Params::polynomial, Params::reflect_in>;
+
+    constexpr typename Params::value_type initial_register =
+      detail::crc_register_initialize<Params::number_of_bits, Params::reflect_in>(Params::initial_value);
+
+    // The raw registers are stored in the results and finalized in place.
+    batch_type::compute(messages, counts, message_count, results, initial_register);
+
+    for(std::size_t index = 0U; index < message_count; ++index)
+    {
+      results[index] = detail::crc_register_finalize<Params::number_of_bits, Params::reflect_in>(results[index], Params::final_xor_value, Params::reflect_out);
+    }
+  }
+
+  // A segment of a message held as a chain of fragments (scatter-gather
+  // input, as with iovec). crc_gather computes the CRC of the concatenation
+  // of the segments without copying them into one buffer. The register is
+  // carried from one segment to the next, so segments can have any length,
+  // including zero and lengths shorter than the block size of the engine.
+
+  struct crc_segment
+  {
+    const std::uint8_t* data;
+    std::size_t         count;
+  };
+
+  template<typename Params,
+           typename EnginePolicy = crc_default_policy>
+  typename Params::value_type crc_gather(const crc_segment* segments, const std::size_t segment_count)
+  {
+    crc_engine<Params, EnginePolicy> engine;
+
+    for(std::size_t index = 0U; index < segment_count; ++index)
+    {
+      engine.update(segments[index].data, segments[index].count);
+    }
+
+    return engine.finalize();
+  }
+
+  // Compute the CRCs of several algorithms over the same message in one
+  // pass. The message is processed in blocks of crc_multi_block_size
+  // bytes, each of which is passed to all of the algorithms in turn
+  // while it is in the cache. So the message is read from memory once,
+  // and the cost of each additional algorithm is only its computation.
+  // For instance:
+  //   std::tie(crc32, crc32_c) = crc_multi<crc_crc32_params, crc_crc32_c_params>(message, count);
+
+  constexpr std::size_t crc_multi_block_size = 32768U;
+
+  namespace detail {
+
+  template<typename... Params,
+           const std::size_t... Index>
+  std::tuple<typename Params::value_type...> crc_multi(const std::uint8_t* message,
+                                                      const std::size_t   count,
+                                                      std::index_sequence<Index...>)
+  {
+    std::tuple<crc_engine<Params>...> engines;
+
+    for(std::size_t offset = 0U; offset < count; offset += crc_multi_block_size)
+    {
+      const std::size_t block_size = (((count - offset) < crc_multi_block_size) ? (count - offset) : crc_multi_block_size);
+
+      using expander_type = int[];
+
+      static_cast<void>(expander_type { 0, (std::get<Index>(engines).update(message + offset, block_size), 0)... });
+    }
+
+    return std::make_tuple(std::get<Index>(engines).finalize()...);
+  }
+
+  } // namespace crc::catalog::detail
+
+  template<typename... Params>
+  std::tuple<typename Params::value_type...> crc_multi(const std::uint8_t* message, const std::size_t count)
+  {
+    return detail::crc_multi<Params...>(message, count, std::index_sequence_for<Params...>());
+  }
+
+  // Rolling CRC over a window of the last WindowSize bytes of a stream,
+  // for instance for content-defined chunking. value() is the CRC of the
+  // window (of all bytes so far before the window is full), the same as
+  // the one-shot CRC of these bytes. Each byte entering the window costs
+  // one step of the byte-at-a-time table and one lookup in the table of
+  // the byte leaving the window. Its entry for a byte b is the register
+  // of b followed by WindowSize zero bytes, to which the correction for
+  // the initial value (which moves out of the window as well) is added.
+  // The last WindowSize bytes are kept, so a stream can be passed in any
+  // number of pieces. find_cut() rolls over a buffer until the CRC of a
+  // full window matches a mask, for instance:
+  //   crc_rolling<crc_crc32_params, 48U> rolling;
+  //   const std::size_t cut = rolling.find_cut(data, size, UINT32_C(0x1FFF));
+  // gives cut points with an average distance of 8 KiB, where cut is
+  // the number of bytes up to and including the cut (or size if none).
+
+  template<typename Params,
+           const std::size_t WindowSize>
+  class crc_rolling
+  {
+  public:
+    using params_type = Params;
+    using value_type  = typename params_type::value_type;
+
+    static constexpr std::size_t window_size = WindowSize;
+
+    static_assert(WindowSize > 0U, "Error: The window must hold at least one byte.");
+
+    crc_rolling() : my_register(initial_register()),
+                    my_window  { },
+                    my_position(0U),
+                    my_count   (0U) { }
+
+    void reset()
+    {
+      my_register = initial_register();
+      my_position = 0U;
+      my_count    = 0U;
+    }
+
+    // Slide the window over one byte.
+    void roll(const std::uint8_t byte_value)
+    {
+      my_register = ((my_count >= WindowSize) ? step(my_register, byte_value, my_window[my_position])
+                                              : table_type::update(my_register, &byte_value, 1U));
+
+      my_window[my_position] = byte_value;
+
+      my_position = (((my_position + 1U) == WindowSize) ? 0U : (my_position + 1U));
+
+      ++my_count;
+    }
+
+    void roll(const std::uint8_t* message, const std::size_t count)
+    {
+      for(std::size_t index = 0U; index < count; ++index)
+      {
+        roll(message[index]);
+      }
+    }
+
+    // Roll over the message until the CRC of a full window satisfies
+    // (value() & mask) == match. Returns the number of bytes rolled over,
+    // which is count if there is no cut point in the message.
+    std::size_t find_cut(const std::uint8_t* message, const std::size_t count, const value_type& mask, const value_type& match = 0U)
+    {
+      // The mask and the value to match in the orientation of the
+      // register, so that the CRC need not be finalized at each byte.
+      const value_type register_mask  = register_bits(mask);
+      const value_type register_match = register_bits(value_type((match ^ params_type::final_xor_value) & mask));
+
+      std::size_t index = 0U;
+
+      // Fill the window.
+      while((my_count < WindowSize) && (index < count))
+      {
+        roll(message[index]);
+
+        ++index;
+
+        if((my_count == WindowSize) && (value_type(my_register & register_mask) == register_match))
+        {
+          return index;
+        }
+      }
+
+      // The outgoing bytes are taken from the kept window until
+      // the window lies within the message, and then from the message.
+      const std::size_t first_index = index;
+
+      const std::size_t kept_end = first_index + (((count - first_index) < WindowSize) ? (count - first_index) : WindowSize);
+
+      value_type crc = my_register;
+
+      bool is_cut = false;
+
+      for(std::size_t position = my_position; (index < kept_end) && (is_cut == false); ++index)
+      {
+        crc = step(crc, message[index], my_window[position]);
+
+        position = (((position + 1U) == WindowSize) ? 0U : (position + 1U));
+
+        is_cut = (value_type(crc & register_mask) == register_match);
+      }
+
+      for( ; (index < count) && (is_cut == false); ++index)
+      {
+        crc = step(crc, message[index], message[index - WindowSize]);
+
+        is_cut = (value_type(crc & register_mask) == register_match);
+      }
+
+      // Keep the last bytes of the window.
+      const std::size_t rolled_count = index - first_index;
+
+      if(rolled_count >= WindowSize)
+      {
+        for(std::size_t window_index = 0U; window_index < WindowSize; ++window_index)
+        {
+          my_window[window_index] = message[(index - WindowSize) + window_index];
+        }
+
+        my_position = 0U;
+      }
+      else
+      {
+        for(std::size_t rolled_index = first_index; rolled_index < index; ++rolled_index)
+        {
+          my_window[my_position] = message[rolled_index];
+
+          my_position = (((my_position + 1U) == WindowSize) ? 0U : (my_position + 1U));
+        }
+      }
+
+      my_register = crc;
+      my_count   += rolled_count;
+
+      return index;
+    }
+
+    value_type value() const
+    {
+      return detail::crc_register_finalize<params_type::number_of_bits, params_type::reflect_in>(my_register,
+                                                                                                 params_type::final_xor_value,
+                                                                                                 params_type::reflect_out);
+    }
+
+    // The number of bytes rolled over since the construction or the last reset.
+    std::uint64_t count() const { return my_count; }
+
+  private:
+    using table_type = detail::crc_table<params_type::number_of_bits, params_type::polynomial, params_type::reflect_in>;
+    using shift_type = detail::crc_byte_shift<params_type::number_of_bits, params_type::polynomial>;
+    using array_type = detail::crc_table_array<value_type>;
+
+    static constexpr value_type initial_register()
+    {
+      return detail::crc_register_initialize<params_type::number_of_bits, params_type::reflect_in>(params_type::initial_value);
+    }
+
+    static value_type step(const value_type& crc, const std::uint8_t incoming_byte, const std::uint8_t outgoing_byte)
+    {
+      return value_type(table_type::update(crc, &incoming_byte, 1U) ^ outgoing_table.values[outgoing_byte]);
+    }
+
+    // The bits of the register giving the bits of a CRC value (the
+    // inverse of the reflection and the alignment of finalize).
+    static constexpr value_type register_bits(const value_type& crc_bits)
+    {
+      return detail::crc_register_initialize<params_type::number_of_bits, params_type::reflect_in>(
+               params_type::reflect_out ? detail::crc_reflect_template<params_type::number_of_bits, value_type>(crc_bits)
+                                        : value_type(crc_bits & value_mask));
+    }
+
+    static constexpr value_type value_mask =
+      value_type((std::numeric_limits<value_type>::max)() >> (std::numeric_limits<value_type>::digits - int(params_type::number_of_bits)));
+
+    // Convert a register to a polynomial in normal orientation.
+    static constexpr value_type normal_value(const value_type& crc)
+    {
+      return ((params_type::reflect_in == false)
+               ? value_type(crc >> (std::numeric_limits<value_type>::digits - int(params_type::number_of_bits)))
+               : detail::crc_reflect_template<params_type::number_of_bits, value_type>(crc));
+    }
+
+    static constexpr value_type shifted_register(const value_type& crc, const std::uint64_t byte_count)
+    {
+      return detail::crc_register_initialize<params_type::number_of_bits, params_type::reflect_in>(shift_type::shift_bytes(normal_value(crc), byte_count));
+    }
+
+    static constexpr array_type outgoing_table_make()
+    {
+      // The initial value entered the register WindowSize bytes before
+      // the window was full. After one more byte, it has to be removed
+      // and the initial value WindowSize bytes before the new window
+      // added instead.
+      const value_type initial_correction =
+        value_type(shifted_register(initial_register(), WindowSize + 1U) ^ shifted_register(initial_register(), WindowSize));
+
+      // The table is linear in the outgoing byte, so it is the sum of the
+      // entries of the bits of the byte.
+      value_type bit_entries[8U] = { };
+
+      for(std::size_t bit = 0U; bit < 8U; ++bit)
+      {
+        bit_entries[bit] = shifted_register(table_type::table.values[std::size_t(1U) << bit], WindowSize);
+      }
+
+      array_type table { };
+
+      for(std::size_t byte_value = 0U; byte_value < 256U; ++byte_value)
+      {
+        value_type entry = initial_correction;
+
+        for(std::size_t bit = 0U; bit < 8U; ++bit)
+        {
+          if(((byte_value >> bit) & 1U) != 0U)
+          {
+            entry ^= bit_entries[bit];
+          }
+        }
+
+        table.values[byte_value] = entry;
+      }
+
+      return table;
+    }
+
+    static constexpr array_type outgoing_table = outgoing_table_make();
+
+    value_type                           my_register;
+    std::array<std::uint8_t, WindowSize> my_window;
+    std::size_t                          my_position;
+    std::uint64_t                        my_count;
+  };
+
+  template<typename Params, const std::size_t WindowSize>
+  constexpr std::size_t crc_rolling<Params, WindowSize>::window_size;
+
+  template<typename Params, const std::size_t WindowSize>
+  constexpr typename crc_rolling<Params, WindowSize>::array_type crc_rolling<Params, WindowSize>::outgoing_table;
+
+  template<typename Params, const std::size_t WindowSize>
+  constexpr typename crc_rolling<Params, WindowSize>::value_type crc_rolling<Params, WindowSize>::value_mask;
+
+  struct crc_crc03_gsm_params          : crc_params< 3U, std::uint8_t (UINTMAX_C(0x0000000000000003)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000007)), false, false, std::uint8_t(UINTMAX_C(0x0000000000000004)), std::uint8_t(UINTMAX_C(0x0000000000000002))> { static constexpr const char* name() { return "CRC-3/GSM"; } };
+  struct crc_crc03_rohc_params         : crc_params< 3U, std::uint8_t (UINTMAX_C(0x0000000000000003)), std::uint8_t (UINTMAX_C(0x0000000000000007)), std::uint8_t (UINTMAX_C(0x0000000000000000)), true , true , std::uint8_t(UINTMAX_C(0x0000000000000006)), std::uint8_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-3/ROHC"; } };
+  struct crc_crc04_interlaken_params   : crc_params< 4U, std::uint8_t (UINTMAX_C(0x0000000000000003)), std::uint8_t (UINTMAX_C(0x000000000000000F)), std::uint8_t (UINTMAX_C(0x000000000000000F)), false, false, std::uint8_t(UINTMAX_C(0x000000000000000B)), std::uint8_t(UINTMAX_C(0x0000000000000002))> { static constexpr const char* name() { return "CRC-4/INTERLAKEN"; } };
+  struct crc_crc04_itu_params          : crc_params< 4U, std::uint8_t (UINTMAX_C(0x0000000000000003)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), true , true , std::uint8_t(UINTMAX_C(0x0000000000000007)), std::uint8_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-4/ITU"; } };
+  struct crc_crc05_epc_params          : crc_params< 5U, std::uint8_t (UINTMAX_C(0x0000000000000009)), std::uint8_t (UINTMAX_C(0x0000000000000009)), std::uint8_t (UINTMAX_C(0x0000000000000000)), false, false, std::uint8_t(UINTMAX_C(0x0000000000000000)), std::uint8_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-5/EPC"; } };
+  struct crc_crc05_itu_params          : crc_params< 5U, std::uint8_t (UINTMAX_C(0x0000000000000015)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), true , true , std::uint8_t(UINTMAX_C(0x0000000000000007)), std::uint8_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-5/ITU"; } };
+  struct crc_crc05_usb_params          : crc_params< 5U, std::uint8_t (UINTMAX_C(0x0000000000000005)), std::uint8_t (UINTMAX_C(0x000000000000001F)), std::uint8_t (UINTMAX_C(0x000000000000001F)), true , true , std::uint8_t(UINTMAX_C(0x0000000000000019)), std::uint8_t(UINTMAX_C(0x0000000000000006))> { static constexpr const char* name() { return "CRC-5/USB"; } };
+  struct crc_crc06_cdma2000_a_params   : crc_params< 6U, std::uint8_t (UINTMAX_C(0x0000000000000027)), std::uint8_t (UINTMAX_C(0x000000000000003F)), std::uint8_t (UINTMAX_C(0x0000000000000000)), false, false, std::uint8_t(UINTMAX_C(0x000000000000000D)), std::uint8_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-6/CDMA2000-A"; } };
+  struct crc_crc06_cdma2000_b_params   : crc_params< 6U, std::uint8_t (UINTMAX_C(0x0000000000000007)), std::uint8_t (UINTMAX_C(0x000000000000003F)), std::uint8_t (UINTMAX_C(0x0000000000000000)), false, false, std::uint8_t(UINTMAX_C(0x000000000000003B)), std::uint8_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-6/CDMA2000-B"; } };
+  struct crc_crc06_darc_params         : crc_params< 6U, std::uint8_t (UINTMAX_C(0x0000000000000019)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), true , true , std::uint8_t(UINTMAX_C(0x0000000000000026)), std::uint8_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-6/DARC"; } };
+  struct crc_crc06_gsm_params          : crc_params< 6U, std::uint8_t (UINTMAX_C(0x000000000000002F)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x000000000000003F)), false, false, std::uint8_t(UINTMAX_C(0x0000000000000013)), std::uint8_t(UINTMAX_C(0x000000000000003A))> { static constexpr const char* name() { return "CRC-6/GSM"; } };
+  struct crc_crc06_itu_params          : crc_params< 6U, std::uint8_t (UINTMAX_C(0x0000000000000003)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), true , true , std::uint8_t(UINTMAX_C(0x0000000000000006)), std::uint8_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-6/ITU"; } };
+  struct crc_crc07_params              : crc_params< 7U, std::uint8_t (UINTMAX_C(0x0000000000000009)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), false, false, std::uint8_t(UINTMAX_C(0x0000000000000075)), std::uint8_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-7"; } };
+  struct crc_crc07_rohc_params         : crc_params< 7U, std::uint8_t (UINTMAX_C(0x000000000000004F)), std::uint8_t (UINTMAX_C(0x000000000000007F)), std::uint8_t (UINTMAX_C(0x0000000000000000)), true , true , std::uint8_t(UINTMAX_C(0x0000000000000053)), std::uint8_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-7/ROHC"; } };
+  struct crc_crc07_umts_params         : crc_params< 7U, std::uint8_t (UINTMAX_C(0x0000000000000045)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), false, false, std::uint8_t(UINTMAX_C(0x0000000000000061)), std::uint8_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-7/UMTS"; } };
+  struct crc_crc08_params              : crc_params< 8U, std::uint8_t (UINTMAX_C(0x0000000000000007)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), false, false, std::uint8_t(UINTMAX_C(0x00000000000000F4)), std::uint8_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-8"; } };
+  struct crc_crc08_autosar_params      : crc_params< 8U, std::uint8_t (UINTMAX_C(0x000000000000002F)), std::uint8_t (UINTMAX_C(0x00000000000000FF)), std::uint8_t (UINTMAX_C(0x00000000000000FF)), false, false, std::uint8_t(UINTMAX_C(0x00000000000000DF)), std::uint8_t(UINTMAX_C(0x0000000000000042))> { static constexpr const char* name() { return "CRC-8/AUTOSAR"; } };
+  struct crc_crc08_bluetooth_params    : crc_params< 8U, std::uint8_t (UINTMAX_C(0x00000000000000A7)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), true , true , std::uint8_t(UINTMAX_C(0x0000000000000026)), std::uint8_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-8/BLUETOOTH"; } };
+  struct crc_crc08_cdma2000_params     : crc_params< 8U, std::uint8_t (UINTMAX_C(0x000000000000009B)), std::uint8_t (UINTMAX_C(0x00000000000000FF)), std::uint8_t (UINTMAX_C(0x0000000000000000)), false, false, std::uint8_t(UINTMAX_C(0x00000000000000DA)), std::uint8_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-8/CDMA2000"; } };
+  struct crc_crc08_darc_params         : crc_params< 8U, std::uint8_t (UINTMAX_C(0x0000000000000039)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), true , true , std::uint8_t(UINTMAX_C(0x0000000000000015)), std::uint8_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-8/DARC"; } };
+  struct crc_crc08_dvb_s2_params       : crc_params< 8U, std::uint8_t (UINTMAX_C(0x00000000000000D5)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), false, false, std::uint8_t(UINTMAX_C(0x00000000000000BC)), std::uint8_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-8/DVB-S2"; } };
+  struct crc_crc08_ebu_params          : crc_params< 8U, std::uint8_t (UINTMAX_C(0x000000000000001D)), std::uint8_t (UINTMAX_C(0x00000000000000FF)), std::uint8_t (UINTMAX_C(0x0000000000000000)), true , true , std::uint8_t(UINTMAX_C(0x0000000000000097)), std::uint8_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-8/EBU"; } };
+  struct crc_crc08_gsm_a_params        : crc_params< 8U, std::uint8_t (UINTMAX_C(0x000000000000001D)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), false, false, std::uint8_t(UINTMAX_C(0x0000000000000037)), std::uint8_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-8/GSM-A"; } };
+  struct crc_crc08_gsm_b_params        : crc_params< 8U, std::uint8_t (UINTMAX_C(0x0000000000000049)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x00000000000000FF)), false, false, std::uint8_t(UINTMAX_C(0x0000000000000094)), std::uint8_t(UINTMAX_C(0x0000000000000053))> { static constexpr const char* name() { return "CRC-8/GSM-B"; } };
+  struct crc_crc08_i_code_params       : crc_params< 8U, std::uint8_t (UINTMAX_C(0x000000000000001D)), std::uint8_t (UINTMAX_C(0x00000000000000FD)), std::uint8_t (UINTMAX_C(0x0000000000000000)), false, false, std::uint8_t(UINTMAX_C(0x000000000000007E)), std::uint8_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-8/I-CODE"; } };
+  struct crc_crc08_itu_params          : crc_params< 8U, std::uint8_t (UINTMAX_C(0x0000000000000007)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000055)), false, false, std::uint8_t(UINTMAX_C(0x00000000000000A1)), std::uint8_t(UINTMAX_C(0x00000000000000AC))> { static constexpr const char* name() { return "CRC-8/ITU"; } };
+  struct crc_crc08_lte_params          : crc_params< 8U, std::uint8_t (UINTMAX_C(0x000000000000009B)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), false, false, std::uint8_t(UINTMAX_C(0x00000000000000EA)), std::uint8_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-8/LTE"; } };
+  struct crc_crc08_maxim_params        : crc_params< 8U, std::uint8_t (UINTMAX_C(0x0000000000000031)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), true , true , std::uint8_t(UINTMAX_C(0x00000000000000A1)), std::uint8_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-8/MAXIM"; } };
+  struct crc_crc08_opensafety_params   : crc_params< 8U, std::uint8_t (UINTMAX_C(0x000000000000002F)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), false, false, std::uint8_t(UINTMAX_C(0x000000000000003E)), std::uint8_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-8/OPENSAFETY"; } };
+  struct crc_crc08_rohc_params         : crc_params< 8U, std::uint8_t (UINTMAX_C(0x0000000000000007)), std::uint8_t (UINTMAX_C(0x00000000000000FF)), std::uint8_t (UINTMAX_C(0x0000000000000000)), true , true , std::uint8_t(UINTMAX_C(0x00000000000000D0)), std::uint8_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-8/ROHC"; } };
+  struct crc_crc08_sae_j1850_params    : crc_params< 8U, std::uint8_t (UINTMAX_C(0x000000000000001D)), std::uint8_t (UINTMAX_C(0x00000000000000FF)), std::uint8_t (UINTMAX_C(0x00000000000000FF)), false, false, std::uint8_t(UINTMAX_C(0x000000000000004B)), std::uint8_t(UINTMAX_C(0x00000000000000C4))> { static constexpr const char* name() { return "CRC-8/SAE-J1850"; } };
+  struct crc_crc08_wcdma_params        : crc_params< 8U, std::uint8_t (UINTMAX_C(0x000000000000009B)), std::uint8_t (UINTMAX_C(0x0000000000000000)), std::uint8_t (UINTMAX_C(0x0000000000000000)), true , true , std::uint8_t(UINTMAX_C(0x0000000000000025)), std::uint8_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-8/WCDMA"; } };
+  struct crc_crc10_params              : crc_params<10U, std::uint16_t(UINTMAX_C(0x0000000000000233)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint16_t(UINTMAX_C(0x0000000000000199)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-10"; } };
+  struct crc_crc10_cdma2000_params     : crc_params<10U, std::uint16_t(UINTMAX_C(0x00000000000003D9)), std::uint16_t(UINTMAX_C(0x00000000000003FF)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint16_t(UINTMAX_C(0x0000000000000233)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-10/CDMA2000"; } };
+  struct crc_crc10_gsm_params          : crc_params<10U, std::uint16_t(UINTMAX_C(0x0000000000000175)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x00000000000003FF)), false, false, std::uint16_t(UINTMAX_C(0x000000000000012A)), std::uint16_t(UINTMAX_C(0x00000000000000C6))> { static constexpr const char* name() { return "CRC-10/GSM"; } };
+  struct crc_crc11_params              : crc_params<11U, std::uint16_t(UINTMAX_C(0x0000000000000385)), std::uint16_t(UINTMAX_C(0x000000000000001A)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint16_t(UINTMAX_C(0x00000000000005A3)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-11"; } };
+  struct crc_crc11_umts_params         : crc_params<11U, std::uint16_t(UINTMAX_C(0x0000000000000307)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint16_t(UINTMAX_C(0x0000000000000061)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-11/UMTS"; } };
+  struct crc_crc12_cdma2000_params     : crc_params<12U, std::uint16_t(UINTMAX_C(0x0000000000000F13)), std::uint16_t(UINTMAX_C(0x0000000000000FFF)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint16_t(UINTMAX_C(0x0000000000000D4D)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-12/CDMA2000"; } };
+  struct crc_crc12_dect_params         : crc_params<12U, std::uint16_t(UINTMAX_C(0x000000000000080F)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint16_t(UINTMAX_C(0x0000000000000F5B)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-12/DECT"; } };
+  struct crc_crc12_gsm_params          : crc_params<12U, std::uint16_t(UINTMAX_C(0x0000000000000D31)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000FFF)), false, false, std::uint16_t(UINTMAX_C(0x0000000000000B34)), std::uint16_t(UINTMAX_C(0x0000000000000178))> { static constexpr const char* name() { return "CRC-12/GSM"; } };
+  struct crc_crc12_umts_params         : crc_params<12U, std::uint16_t(UINTMAX_C(0x000000000000080F)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, true , std::uint16_t(UINTMAX_C(0x0000000000000DAF)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-12/UMTS"; } };
+  struct crc_crc13_bbc_params          : crc_params<13U, std::uint16_t(UINTMAX_C(0x0000000000001CF5)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint16_t(UINTMAX_C(0x00000000000004FA)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-13/BBC"; } };
+  struct crc_crc14_darc_params         : crc_params<14U, std::uint16_t(UINTMAX_C(0x0000000000000805)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), true , true , std::uint16_t(UINTMAX_C(0x000000000000082D)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-14/DARC"; } };
+  struct crc_crc14_gsm_params          : crc_params<14U, std::uint16_t(UINTMAX_C(0x000000000000202D)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000003FFF)), false, false, std::uint16_t(UINTMAX_C(0x00000000000030AE)), std::uint16_t(UINTMAX_C(0x000000000000031E))> { static constexpr const char* name() { return "CRC-14/GSM"; } };
+  struct crc_crc15_params              : crc_params<15U, std::uint16_t(UINTMAX_C(0x0000000000004599)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint16_t(UINTMAX_C(0x000000000000059E)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-15"; } };
+  struct crc_crc15_mpt1327_params      : crc_params<15U, std::uint16_t(UINTMAX_C(0x0000000000006815)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000001)), false, false, std::uint16_t(UINTMAX_C(0x0000000000002566)), std::uint16_t(UINTMAX_C(0x0000000000006815))> { static constexpr const char* name() { return "CRC-15/MPT1327"; } };
+  struct crc_crc16_arc_params          : crc_params<16U, std::uint16_t(UINTMAX_C(0x0000000000008005)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), true , true , std::uint16_t(UINTMAX_C(0x000000000000BB3D)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-16/ARC"; } };
+  struct crc_crc16_aug_ccitt_params    : crc_params<16U, std::uint16_t(UINTMAX_C(0x0000000000001021)), std::uint16_t(UINTMAX_C(0x0000000000001D0F)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint16_t(UINTMAX_C(0x000000000000E5CC)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-16/AUG-CCITT"; } };
+  struct crc_crc16_buypass_params      : crc_params<16U, std::uint16_t(UINTMAX_C(0x0000000000008005)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint16_t(UINTMAX_C(0x000000000000FEE8)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-16/BUYPASS"; } };
+  struct crc_crc16_ccitt_false_params  : crc_params<16U, std::uint16_t(UINTMAX_C(0x0000000000001021)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint16_t(UINTMAX_C(0x00000000000029B1)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-16/CCITT-FALSE"; } };
+  struct crc_crc16_cdma2000_params     : crc_params<16U, std::uint16_t(UINTMAX_C(0x000000000000C867)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint16_t(UINTMAX_C(0x0000000000004C06)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-16/CDMA2000"; } };
+  struct crc_crc16_cms_params          : crc_params<16U, std::uint16_t(UINTMAX_C(0x0000000000008005)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint16_t(UINTMAX_C(0x000000000000AEE7)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-16/CMS"; } };
+  struct crc_crc16_dds_110_params      : crc_params<16U, std::uint16_t(UINTMAX_C(0x0000000000008005)), std::uint16_t(UINTMAX_C(0x000000000000800D)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint16_t(UINTMAX_C(0x0000000000009ECF)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-16/DDS-110"; } };
+  struct crc_crc16_dect_r_params       : crc_params<16U, std::uint16_t(UINTMAX_C(0x0000000000000589)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000001)), false, false, std::uint16_t(UINTMAX_C(0x000000000000007E)), std::uint16_t(UINTMAX_C(0x0000000000000589))> { static constexpr const char* name() { return "CRC-16/DECT-R"; } };
+  struct crc_crc16_dect_x_params       : crc_params<16U, std::uint16_t(UINTMAX_C(0x0000000000000589)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint16_t(UINTMAX_C(0x000000000000007F)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-16/DECT-X"; } };
+  struct crc_crc16_dnp_params          : crc_params<16U, std::uint16_t(UINTMAX_C(0x0000000000003D65)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), true , true , std::uint16_t(UINTMAX_C(0x000000000000EA82)), std::uint16_t(UINTMAX_C(0x00000000000066C5))> { static constexpr const char* name() { return "CRC-16/DNP"; } };
+  struct crc_crc16_en_13757_params     : crc_params<16U, std::uint16_t(UINTMAX_C(0x0000000000003D65)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), false, false, std::uint16_t(UINTMAX_C(0x000000000000C2B7)), std::uint16_t(UINTMAX_C(0x000000000000A366))> { static constexpr const char* name() { return "CRC-16/EN-13757"; } };
+  struct crc_crc16_genibus_params      : crc_params<16U, std::uint16_t(UINTMAX_C(0x0000000000001021)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), false, false, std::uint16_t(UINTMAX_C(0x000000000000D64E)), std::uint16_t(UINTMAX_C(0x0000000000001D0F))> { static constexpr const char* name() { return "CRC-16/GENIBUS"; } };
+  struct crc_crc16_gsm_params          : crc_params<16U, std::uint16_t(UINTMAX_C(0x0000000000001021)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), false, false, std::uint16_t(UINTMAX_C(0x000000000000CE3C)), std::uint16_t(UINTMAX_C(0x0000000000001D0F))> { static constexpr const char* name() { return "CRC-16/GSM"; } };
+  struct crc_crc16_lj1200_params       : crc_params<16U, std::uint16_t(UINTMAX_C(0x0000000000006F63)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint16_t(UINTMAX_C(0x000000000000BDF4)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-16/LJ1200"; } };
+  struct crc_crc16_maxim_params        : crc_params<16U, std::uint16_t(UINTMAX_C(0x0000000000008005)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), true , true , std::uint16_t(UINTMAX_C(0x00000000000044C2)), std::uint16_t(UINTMAX_C(0x000000000000B001))> { static constexpr const char* name() { return "CRC-16/MAXIM"; } };
+  struct crc_crc16_mcrf4xx_params      : crc_params<16U, std::uint16_t(UINTMAX_C(0x0000000000001021)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), std::uint16_t(UINTMAX_C(0x0000000000000000)), true , true , std::uint16_t(UINTMAX_C(0x0000000000006F91)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-16/MCRF4XX"; } };
+  struct crc_crc16_opensafety_a_params : crc_params<16U, std::uint16_t(UINTMAX_C(0x0000000000005935)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint16_t(UINTMAX_C(0x0000000000005D38)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-16/OPENSAFETY-A"; } };
+  struct crc_crc16_opensafety_b_params : crc_params<16U, std::uint16_t(UINTMAX_C(0x000000000000755B)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint16_t(UINTMAX_C(0x00000000000020FE)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-16/OPENSAFETY-B"; } };
+  struct crc_crc16_profibus_params     : crc_params<16U, std::uint16_t(UINTMAX_C(0x0000000000001DCF)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), false, false, std::uint16_t(UINTMAX_C(0x000000000000A819)), std::uint16_t(UINTMAX_C(0x000000000000E394))> { static constexpr const char* name() { return "CRC-16/PROFIBUS"; } };
+  struct crc_crc16_riello_params       : crc_params<16U, std::uint16_t(UINTMAX_C(0x0000000000001021)), std::uint16_t(UINTMAX_C(0x000000000000B2AA)), std::uint16_t(UINTMAX_C(0x0000000000000000)), true , true , std::uint16_t(UINTMAX_C(0x00000000000063D0)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-16/RIELLO"; } };
+  struct crc_crc16_t10_dif_params      : crc_params<16U, std::uint16_t(UINTMAX_C(0x0000000000008BB7)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint16_t(UINTMAX_C(0x000000000000D0DB)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-16/T10-DIF"; } };
+  struct crc_crc16_teledisk_params     : crc_params<16U, std::uint16_t(UINTMAX_C(0x000000000000A097)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint16_t(UINTMAX_C(0x0000000000000FB3)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-16/TELEDISK"; } };
+  struct crc_crc16_tms37157_params     : crc_params<16U, std::uint16_t(UINTMAX_C(0x0000000000001021)), std::uint16_t(UINTMAX_C(0x00000000000089EC)), std::uint16_t(UINTMAX_C(0x0000000000000000)), true , true , std::uint16_t(UINTMAX_C(0x00000000000026B1)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-16/TMS37157"; } };
+  struct crc_crc16_usb_params          : crc_params<16U, std::uint16_t(UINTMAX_C(0x0000000000008005)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), true , true , std::uint16_t(UINTMAX_C(0x000000000000B4C8)), std::uint16_t(UINTMAX_C(0x000000000000B001))> { static constexpr const char* name() { return "CRC-16/USB"; } };
+  struct crc_crc16_a_params            : crc_params<16U, std::uint16_t(UINTMAX_C(0x0000000000001021)), std::uint16_t(UINTMAX_C(0x000000000000C6C6)), std::uint16_t(UINTMAX_C(0x0000000000000000)), true , true , std::uint16_t(UINTMAX_C(0x000000000000BF05)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-16/A"; } };
+  struct crc_crc16_kermit_params       : crc_params<16U, std::uint16_t(UINTMAX_C(0x0000000000001021)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), true , true , std::uint16_t(UINTMAX_C(0x0000000000002189)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-16/KERMIT"; } };
+  struct crc_crc16_modbus_params       : crc_params<16U, std::uint16_t(UINTMAX_C(0x0000000000008005)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), std::uint16_t(UINTMAX_C(0x0000000000000000)), true , true , std::uint16_t(UINTMAX_C(0x0000000000004B37)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-16/MODBUS"; } };
+  struct crc_crc16_x_25_params         : crc_params<16U, std::uint16_t(UINTMAX_C(0x0000000000001021)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), std::uint16_t(UINTMAX_C(0x000000000000FFFF)), true , true , std::uint16_t(UINTMAX_C(0x000000000000906E)), std::uint16_t(UINTMAX_C(0x000000000000F0B8))> { static constexpr const char* name() { return "CRC-16/X-25"; } };
+  struct crc_crc16_xmodem_params       : crc_params<16U, std::uint16_t(UINTMAX_C(0x0000000000001021)), std::uint16_t(UINTMAX_C(0x0000000000000000)), std::uint16_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint16_t(UINTMAX_C(0x00000000000031C3)), std::uint16_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-16/XMODEM"; } };
+  struct crc_crc17_can_fd_params       : crc_params<17U, std::uint32_t(UINTMAX_C(0x000000000001685B)), std::uint32_t(UINTMAX_C(0x0000000000000000)), std::uint32_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint32_t(UINTMAX_C(0x0000000000004F03)), std::uint32_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-17/CAN-FD"; } };
+  struct crc_crc21_can_fd_params       : crc_params<21U, std::uint32_t(UINTMAX_C(0x0000000000102899)), std::uint32_t(UINTMAX_C(0x0000000000000000)), std::uint32_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint32_t(UINTMAX_C(0x00000000000ED841)), std::uint32_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-21/CAN-FD"; } };
+  struct crc_crc24_params              : crc_params<24U, std::uint32_t(UINTMAX_C(0x0000000000864CFB)), std::uint32_t(UINTMAX_C(0x0000000000B704CE)), std::uint32_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint32_t(UINTMAX_C(0x000000000021CF02)), std::uint32_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-24"; } };
+  struct crc_crc24_ble_params          : crc_params<24U, std::uint32_t(UINTMAX_C(0x000000000000065B)), std::uint32_t(UINTMAX_C(0x0000000000555555)), std::uint32_t(UINTMAX_C(0x0000000000000000)), true , true , std::uint32_t(UINTMAX_C(0x0000000000C25A56)), std::uint32_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-24/BLE"; } };
+  struct crc_crc24_flexray_a_params    : crc_params<24U, std::uint32_t(UINTMAX_C(0x00000000005D6DCB)), std::uint32_t(UINTMAX_C(0x0000000000FEDCBA)), std::uint32_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint32_t(UINTMAX_C(0x00000000007979BD)), std::uint32_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-24/FLEXRAY-A"; } };
+  struct crc_crc24_flexray_b_params    : crc_params<24U, std::uint32_t(UINTMAX_C(0x00000000005D6DCB)), std::uint32_t(UINTMAX_C(0x0000000000ABCDEF)), std::uint32_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint32_t(UINTMAX_C(0x00000000001F23B8)), std::uint32_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-24/FLEXRAY-B"; } };
+  struct crc_crc24_interlaken_params   : crc_params<24U, std::uint32_t(UINTMAX_C(0x0000000000328B63)), std::uint32_t(UINTMAX_C(0x0000000000FFFFFF)), std::uint32_t(UINTMAX_C(0x0000000000FFFFFF)), false, false, std::uint32_t(UINTMAX_C(0x0000000000B4F3E6)), std::uint32_t(UINTMAX_C(0x0000000000144E63))> { static constexpr const char* name() { return "CRC-24/INTERLAKEN"; } };
+  struct crc_crc24_lte_a_params        : crc_params<24U, std::uint32_t(UINTMAX_C(0x0000000000864CFB)), std::uint32_t(UINTMAX_C(0x0000000000000000)), std::uint32_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint32_t(UINTMAX_C(0x0000000000CDE703)), std::uint32_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-24/LTE-A"; } };
+  struct crc_crc24_lte_b_params        : crc_params<24U, std::uint32_t(UINTMAX_C(0x0000000000800063)), std::uint32_t(UINTMAX_C(0x0000000000000000)), std::uint32_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint32_t(UINTMAX_C(0x000000000023EF52)), std::uint32_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-24/LTE-B"; } };
+  struct crc_crc30_cdma_params         : crc_params<30U, std::uint32_t(UINTMAX_C(0x000000002030B9C7)), std::uint32_t(UINTMAX_C(0x000000003FFFFFFF)), std::uint32_t(UINTMAX_C(0x000000003FFFFFFF)), false, false, std::uint32_t(UINTMAX_C(0x0000000004C34ABF)), std::uint32_t(UINTMAX_C(0x0000000034EFA55A))> { static constexpr const char* name() { return "CRC-30/CDMA"; } };
+  struct crc_crc31_philips_params      : crc_params<31U, std::uint32_t(UINTMAX_C(0x0000000004C11DB7)), std::uint32_t(UINTMAX_C(0x000000007FFFFFFF)), std::uint32_t(UINTMAX_C(0x000000007FFFFFFF)), false, false, std::uint32_t(UINTMAX_C(0x000000000CE9E46C)), std::uint32_t(UINTMAX_C(0x000000004EAF26F1))> { static constexpr const char* name() { return "CRC-31/PHILIPS"; } };
+  struct crc_crc32_params              : crc_params<32U, std::uint32_t(UINTMAX_C(0x0000000004C11DB7)), std::uint32_t(UINTMAX_C(0x00000000FFFFFFFF)), std::uint32_t(UINTMAX_C(0x00000000FFFFFFFF)), true , true , std::uint32_t(UINTMAX_C(0x00000000CBF43926)), std::uint32_t(UINTMAX_C(0x00000000DEBB20E3))> { static constexpr const char* name() { return "CRC-32"; } };
+  struct crc_crc32_autosar_params      : crc_params<32U, std::uint32_t(UINTMAX_C(0x00000000F4ACFB13)), std::uint32_t(UINTMAX_C(0x00000000FFFFFFFF)), std::uint32_t(UINTMAX_C(0x00000000FFFFFFFF)), true , true , std::uint32_t(UINTMAX_C(0x000000001697D06A)), std::uint32_t(UINTMAX_C(0x00000000904CDDBF))> { static constexpr const char* name() { return "CRC-32/AUTOSAR"; } };
+  struct crc_crc32_bzip2_params        : crc_params<32U, std::uint32_t(UINTMAX_C(0x0000000004C11DB7)), std::uint32_t(UINTMAX_C(0x00000000FFFFFFFF)), std::uint32_t(UINTMAX_C(0x00000000FFFFFFFF)), false, false, std::uint32_t(UINTMAX_C(0x00000000FC891918)), std::uint32_t(UINTMAX_C(0x00000000C704DD7B))> { static constexpr const char* name() { return "CRC-32/BZIP2"; } };
+  struct crc_crc32_c_params            : crc_params<32U, std::uint32_t(UINTMAX_C(0x000000001EDC6F41)), std::uint32_t(UINTMAX_C(0x00000000FFFFFFFF)), std::uint32_t(UINTMAX_C(0x00000000FFFFFFFF)), true , true , std::uint32_t(UINTMAX_C(0x00000000E3069283)), std::uint32_t(UINTMAX_C(0x00000000B798B438))> { static constexpr const char* name() { return "CRC-32C"; } };
+  struct crc_crc32_d_params            : crc_params<32U, std::uint32_t(UINTMAX_C(0x00000000A833982B)), std::uint32_t(UINTMAX_C(0x00000000FFFFFFFF)), std::uint32_t(UINTMAX_C(0x00000000FFFFFFFF)), true , true , std::uint32_t(UINTMAX_C(0x0000000087315576)), std::uint32_t(UINTMAX_C(0x0000000045270551))> { static constexpr const char* name() { return "CRC-32D"; } };
+  struct crc_crc32_mpeg_2_params       : crc_params<32U, std::uint32_t(UINTMAX_C(0x0000000004C11DB7)), std::uint32_t(UINTMAX_C(0x00000000FFFFFFFF)), std::uint32_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint32_t(UINTMAX_C(0x000000000376E6E7)), std::uint32_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-32/MPEG-2"; } };
+  struct crc_crc32_posix_params        : crc_params<32U, std::uint32_t(UINTMAX_C(0x0000000004C11DB7)), std::uint32_t(UINTMAX_C(0x0000000000000000)), std::uint32_t(UINTMAX_C(0x00000000FFFFFFFF)), false, false, std::uint32_t(UINTMAX_C(0x00000000765E7680)), std::uint32_t(UINTMAX_C(0x00000000C704DD7B))> { static constexpr const char* name() { return "CRC-32/POSIX"; } };
+  struct crc_crc32_q_params            : crc_params<32U, std::uint32_t(UINTMAX_C(0x00000000814141AB)), std::uint32_t(UINTMAX_C(0x0000000000000000)), std::uint32_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint32_t(UINTMAX_C(0x000000003010BF7F)), std::uint32_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-32Q"; } };
+  struct crc_crc32_jamcrc_params       : crc_params<32U, std::uint32_t(UINTMAX_C(0x0000000004C11DB7)), std::uint32_t(UINTMAX_C(0x00000000FFFFFFFF)), std::uint32_t(UINTMAX_C(0x0000000000000000)), true , true , std::uint32_t(UINTMAX_C(0x00000000340BC6D9)), std::uint32_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-32/JAMCRC"; } };
+  struct crc_crc32_xfer_params         : crc_params<32U, std::uint32_t(UINTMAX_C(0x00000000000000AF)), std::uint32_t(UINTMAX_C(0x0000000000000000)), std::uint32_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint32_t(UINTMAX_C(0x00000000BD0BE338)), std::uint32_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-32/XFER"; } };
+  struct crc_crc40_gsm_params          : crc_params<40U, std::uint64_t(UINTMAX_C(0x0000000004820009)), std::uint64_t(UINTMAX_C(0x0000000000000000)), std::uint64_t(UINTMAX_C(0x000000FFFFFFFFFF)), false, false, std::uint64_t(UINTMAX_C(0x000000D4164FC646)), std::uint64_t(UINTMAX_C(0x000000C4FF8071FF))> { static constexpr const char* name() { return "CRC-40/GSM"; } };
+  struct crc_crc64_params              : crc_params<64U, std::uint64_t(UINTMAX_C(0x42F0E1EBA9EA3693)), std::uint64_t(UINTMAX_C(0x0000000000000000)), std::uint64_t(UINTMAX_C(0x0000000000000000)), false, false, std::uint64_t(UINTMAX_C(0x6C40DF5F0B497347)), std::uint64_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-64"; } };
+  struct crc_crc64_go_iso_params       : crc_params<64U, std::uint64_t(UINTMAX_C(0x000000000000001B)), std::uint64_t(UINTMAX_C(0xFFFFFFFFFFFFFFFF)), std::uint64_t(UINTMAX_C(0xFFFFFFFFFFFFFFFF)), true , true , std::uint64_t(UINTMAX_C(0xB90956C775A41001)), std::uint64_t(UINTMAX_C(0x5300000000000000))> { static constexpr const char* name() { return "CRC-64/GO-ISO"; } };
+  struct crc_crc64_we_params           : crc_params<64U, std::uint64_t(UINTMAX_C(0x42F0E1EBA9EA3693)), std::uint64_t(UINTMAX_C(0xFFFFFFFFFFFFFFFF)), std::uint64_t(UINTMAX_C(0xFFFFFFFFFFFFFFFF)), false, false, std::uint64_t(UINTMAX_C(0x62EC59E3F1A4F00A)), std::uint64_t(UINTMAX_C(0xFCACBEBD5931A992))> { static constexpr const char* name() { return "CRC-64/WE"; } };
+  struct crc_crc64_xz_params           : crc_params<64U, std::uint64_t(UINTMAX_C(0x42F0E1EBA9EA3693)), std::uint64_t(UINTMAX_C(0xFFFFFFFFFFFFFFFF)), std::uint64_t(UINTMAX_C(0xFFFFFFFFFFFFFFFF)), true , true , std::uint64_t(UINTMAX_C(0x995DC9BBDF1939FA)), std::uint64_t(UINTMAX_C(0x49958C9ABD7D353F))> { static constexpr const char* name() { return "CRC-64/XZ"; } };
+  struct crc_crc64_jones_redis_params  : crc_params<64U, std::uint64_t(UINTMAX_C(0xAD93D23594C935A9)), std::uint64_t(UINTMAX_C(0x0000000000000000)), std::uint64_t(UINTMAX_C(0x0000000000000000)), true , true , std::uint64_t(UINTMAX_C(0xE9C6D914C4B8D9CA)), std::uint64_t(UINTMAX_C(0x0000000000000000))> { static constexpr const char* name() { return "CRC-64/REDIS"; } };
+
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc03_gsm         (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc03_gsm_params         >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc03_rohc        (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc03_rohc_params        >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc04_interlaken  (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc04_interlaken_params  >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc04_itu         (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc04_itu_params         >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc05_epc         (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc05_epc_params         >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc05_itu         (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc05_itu_params         >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc05_usb         (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc05_usb_params         >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc06_cdma2000_a  (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc06_cdma2000_a_params  >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc06_cdma2000_b  (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc06_cdma2000_b_params  >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc06_darc        (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc06_darc_params        >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc06_gsm         (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc06_gsm_params         >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc06_itu         (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc06_itu_params         >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc07             (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc07_params             >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc07_rohc        (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc07_rohc_params        >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc07_umts        (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc07_umts_params        >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc08             (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc08_params             >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc08_autosar     (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc08_autosar_params     >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc08_bluetooth   (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc08_bluetooth_params   >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc08_cdma2000    (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc08_cdma2000_params    >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc08_darc        (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc08_darc_params        >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc08_dvb_s2      (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc08_dvb_s2_params      >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc08_ebu         (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc08_ebu_params         >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc08_gsm_a       (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc08_gsm_a_params       >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc08_gsm_b       (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc08_gsm_b_params       >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc08_i_code      (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc08_i_code_params      >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc08_itu         (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc08_itu_params         >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc08_lte         (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc08_lte_params         >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc08_maxim       (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc08_maxim_params       >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc08_opensafety  (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc08_opensafety_params  >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc08_rohc        (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc08_rohc_params        >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc08_sae_j1850   (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc08_sae_j1850_params   >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint8_t  crc_crc08_wcdma       (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc08_wcdma_params       >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc10             (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc10_params             >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc10_cdma2000    (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc10_cdma2000_params    >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc10_gsm         (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc10_gsm_params         >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc11             (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc11_params             >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc11_umts        (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc11_umts_params        >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc12_cdma2000    (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc12_cdma2000_params    >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc12_dect        (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc12_dect_params        >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc12_gsm         (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc12_gsm_params         >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc12_umts        (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc12_umts_params        >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc13_bbc         (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc13_bbc_params         >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc14_darc        (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc14_darc_params        >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc14_gsm         (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc14_gsm_params         >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc15             (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc15_params             >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc15_mpt1327     (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc15_mpt1327_params     >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_arc         (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_arc_params         >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_aug_ccitt   (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_aug_ccitt_params   >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_buypass     (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_buypass_params     >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_ccitt_false (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_ccitt_false_params >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_cdma2000    (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_cdma2000_params    >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_cms         (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_cms_params         >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_dds_110     (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_dds_110_params     >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_dect_r      (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_dect_r_params      >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_dect_x      (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_dect_x_params      >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_dnp         (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_dnp_params         >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_en_13757    (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_en_13757_params    >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_genibus     (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_genibus_params     >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_gsm         (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_gsm_params         >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_lj1200      (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_lj1200_params      >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_maxim       (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_maxim_params       >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_mcrf4xx     (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_mcrf4xx_params     >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_opensafety_a(const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_opensafety_a_params>::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_opensafety_b(const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_opensafety_b_params>::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_profibus    (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_profibus_params    >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_riello      (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_riello_params      >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_t10_dif     (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_t10_dif_params     >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_teledisk    (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_teledisk_params    >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_tms37157    (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_tms37157_params    >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_usb         (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_usb_params         >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_a           (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_a_params           >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_kermit      (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_kermit_params      >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_modbus      (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_modbus_params      >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_x_25        (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_x_25_params        >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint16_t crc_crc16_xmodem      (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc16_xmodem_params      >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint32_t crc_crc17_can_fd      (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc17_can_fd_params      >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint32_t crc_crc21_can_fd      (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc21_can_fd_params      >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint32_t crc_crc24             (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc24_params             >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint32_t crc_crc24_ble         (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc24_ble_params         >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint32_t crc_crc24_flexray_a   (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc24_flexray_a_params   >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint32_t crc_crc24_flexray_b   (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc24_flexray_b_params   >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint32_t crc_crc24_interlaken  (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc24_interlaken_params  >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint32_t crc_crc24_lte_a       (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc24_lte_a_params       >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint32_t crc_crc24_lte_b       (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc24_lte_b_params       >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint32_t crc_crc30_cdma        (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc30_cdma_params        >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint32_t crc_crc31_philips     (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc31_philips_params     >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint32_t crc_crc32             (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc32_params             >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint32_t crc_crc32_autosar     (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc32_autosar_params     >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint32_t crc_crc32_bzip2       (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc32_bzip2_params       >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint32_t crc_crc32_c           (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc32_c_params           >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint32_t crc_crc32_d           (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc32_d_params           >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint32_t crc_crc32_mpeg_2      (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc32_mpeg_2_params      >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint32_t crc_crc32_posix       (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc32_posix_params       >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint32_t crc_crc32_q           (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc32_q_params           >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint32_t crc_crc32_jamcrc      (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc32_jamcrc_params      >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint32_t crc_crc32_xfer        (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc32_xfer_params        >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint64_t crc_crc40_gsm         (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc40_gsm_params         >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint64_t crc_crc64             (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc64_params             >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint64_t crc_crc64_go_iso      (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc64_go_iso_params      >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint64_t crc_crc64_we          (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc64_we_params          >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint64_t crc_crc64_xz          (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc64_xz_params          >::checksum(message, count); }
+  inline CRC_CATALOG_CONSTEXPR std::uint64_t crc_crc64_jones_redis (const std::uint8_t* message, const std::size_t count) { return crc_engine<crc_crc64_jones_redis_params >::checksum(message, count); }
+
+  inline constexpr std::uint8_t  crc_crc03_gsm_combine         (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc03_gsm_params         >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc03_rohc_combine        (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc03_rohc_params        >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc04_interlaken_combine  (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc04_interlaken_params  >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc04_itu_combine         (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc04_itu_params         >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc05_epc_combine         (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc05_epc_params         >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc05_itu_combine         (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc05_itu_params         >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc05_usb_combine         (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc05_usb_params         >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc06_cdma2000_a_combine  (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc06_cdma2000_a_params  >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc06_cdma2000_b_combine  (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc06_cdma2000_b_params  >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc06_darc_combine        (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc06_darc_params        >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc06_gsm_combine         (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc06_gsm_params         >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc06_itu_combine         (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc06_itu_params         >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc07_combine             (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc07_params             >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc07_rohc_combine        (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc07_rohc_params        >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc07_umts_combine        (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc07_umts_params        >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc08_combine             (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc08_params             >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc08_autosar_combine     (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc08_autosar_params     >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc08_bluetooth_combine   (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc08_bluetooth_params   >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc08_cdma2000_combine    (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc08_cdma2000_params    >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc08_darc_combine        (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc08_darc_params        >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc08_dvb_s2_combine      (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc08_dvb_s2_params      >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc08_ebu_combine         (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc08_ebu_params         >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc08_gsm_a_combine       (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc08_gsm_a_params       >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc08_gsm_b_combine       (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc08_gsm_b_params       >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc08_i_code_combine      (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc08_i_code_params      >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc08_itu_combine         (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc08_itu_params         >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc08_lte_combine         (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc08_lte_params         >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc08_maxim_combine       (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc08_maxim_params       >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc08_opensafety_combine  (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc08_opensafety_params  >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc08_rohc_combine        (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc08_rohc_params        >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc08_sae_j1850_combine   (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc08_sae_j1850_params   >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint8_t  crc_crc08_wcdma_combine       (const std::uint8_t  crc_a, const std::uint8_t  crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc08_wcdma_params       >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc10_combine             (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc10_params             >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc10_cdma2000_combine    (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc10_cdma2000_params    >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc10_gsm_combine         (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc10_gsm_params         >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc11_combine             (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc11_params             >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc11_umts_combine        (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc11_umts_params        >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc12_cdma2000_combine    (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc12_cdma2000_params    >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc12_dect_combine        (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc12_dect_params        >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc12_gsm_combine         (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc12_gsm_params         >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc12_umts_combine        (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc12_umts_params        >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc13_bbc_combine         (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc13_bbc_params         >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc14_darc_combine        (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc14_darc_params        >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc14_gsm_combine         (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc14_gsm_params         >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc15_combine             (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc15_params             >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc15_mpt1327_combine     (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc15_mpt1327_params     >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_arc_combine         (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_arc_params         >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_aug_ccitt_combine   (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_aug_ccitt_params   >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_buypass_combine     (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_buypass_params     >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_ccitt_false_combine (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_ccitt_false_params >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_cdma2000_combine    (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_cdma2000_params    >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_cms_combine         (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_cms_params         >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_dds_110_combine     (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_dds_110_params     >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_dect_r_combine      (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_dect_r_params      >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_dect_x_combine      (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_dect_x_params      >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_dnp_combine         (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_dnp_params         >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_en_13757_combine    (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_en_13757_params    >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_genibus_combine     (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_genibus_params     >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_gsm_combine         (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_gsm_params         >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_lj1200_combine      (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_lj1200_params      >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_maxim_combine       (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_maxim_params       >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_mcrf4xx_combine     (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_mcrf4xx_params     >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_opensafety_a_combine(const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_opensafety_a_params>(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_opensafety_b_combine(const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_opensafety_b_params>(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_profibus_combine    (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_profibus_params    >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_riello_combine      (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_riello_params      >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_t10_dif_combine     (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_t10_dif_params     >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_teledisk_combine    (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_teledisk_params    >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_tms37157_combine    (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_tms37157_params    >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_usb_combine         (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_usb_params         >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_a_combine           (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_a_params           >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_kermit_combine      (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_kermit_params      >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_modbus_combine      (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_modbus_params      >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_x_25_combine        (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_x_25_params        >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint16_t crc_crc16_xmodem_combine      (const std::uint16_t crc_a, const std::uint16_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc16_xmodem_params      >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint32_t crc_crc17_can_fd_combine      (const std::uint32_t crc_a, const std::uint32_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc17_can_fd_params      >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint32_t crc_crc21_can_fd_combine      (const std::uint32_t crc_a, const std::uint32_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc21_can_fd_params      >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint32_t crc_crc24_combine             (const std::uint32_t crc_a, const std::uint32_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc24_params             >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint32_t crc_crc24_ble_combine         (const std::uint32_t crc_a, const std::uint32_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc24_ble_params         >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint32_t crc_crc24_flexray_a_combine   (const std::uint32_t crc_a, const std::uint32_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc24_flexray_a_params   >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint32_t crc_crc24_flexray_b_combine   (const std::uint32_t crc_a, const std::uint32_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc24_flexray_b_params   >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint32_t crc_crc24_interlaken_combine  (const std::uint32_t crc_a, const std::uint32_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc24_interlaken_params  >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint32_t crc_crc24_lte_a_combine       (const std::uint32_t crc_a, const std::uint32_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc24_lte_a_params       >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint32_t crc_crc24_lte_b_combine       (const std::uint32_t crc_a, const std::uint32_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc24_lte_b_params       >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint32_t crc_crc30_cdma_combine        (const std::uint32_t crc_a, const std::uint32_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc30_cdma_params        >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint32_t crc_crc31_philips_combine     (const std::uint32_t crc_a, const std::uint32_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc31_philips_params     >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint32_t crc_crc32_combine             (const std::uint32_t crc_a, const std::uint32_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc32_params             >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint32_t crc_crc32_autosar_combine     (const std::uint32_t crc_a, const std::uint32_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc32_autosar_params     >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint32_t crc_crc32_bzip2_combine       (const std::uint32_t crc_a, const std::uint32_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc32_bzip2_params       >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint32_t crc_crc32_c_combine           (const std::uint32_t crc_a, const std::uint32_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc32_c_params           >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint32_t crc_crc32_d_combine           (const std::uint32_t crc_a, const std::uint32_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc32_d_params           >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint32_t crc_crc32_mpeg_2_combine      (const std::uint32_t crc_a, const std::uint32_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc32_mpeg_2_params      >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint32_t crc_crc32_posix_combine       (const std::uint32_t crc_a, const std::uint32_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc32_posix_params       >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint32_t crc_crc32_q_combine           (const std::uint32_t crc_a, const std::uint32_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc32_q_params           >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint32_t crc_crc32_jamcrc_combine      (const std::uint32_t crc_a, const std::uint32_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc32_jamcrc_params      >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint32_t crc_crc32_xfer_combine        (const std::uint32_t crc_a, const std::uint32_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc32_xfer_params        >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint64_t crc_crc40_gsm_combine         (const std::uint64_t crc_a, const std::uint64_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc40_gsm_params         >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint64_t crc_crc64_combine             (const std::uint64_t crc_a, const std::uint64_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc64_params             >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint64_t crc_crc64_go_iso_combine      (const std::uint64_t crc_a, const std::uint64_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc64_go_iso_params      >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint64_t crc_crc64_we_combine          (const std::uint64_t crc_a, const std::uint64_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc64_we_params          >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint64_t crc_crc64_xz_combine          (const std::uint64_t crc_a, const std::uint64_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc64_xz_params          >(crc_a, crc_b, length_b); }
+  inline constexpr std::uint64_t crc_crc64_jones_redis_combine (const std::uint64_t crc_a, const std::uint64_t crc_b, const std::uint64_t length_b) { return crc_combine<crc_crc64_jones_redis_params >(crc_a, crc_b, length_b); }
 
   } } // namespace crc::catalog
 
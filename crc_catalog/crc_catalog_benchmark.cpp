@@ -0,0 +1,625 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2000 - 2018.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Throughput and latency benchmark of every catalog algorithm and engine.
+//
+// Usage: crc_catalog_benchmark [options]
+//   --algorithm=NAME[,NAME...] catalog names or identifiers (default: all)
+//   --engine=NAME[,NAME...]    bitwise, nibble, nibble_pair, table, slicing, clmul, default,
+//                              batch (default: all available)
+//   --sizes=SIZE[,SIZE...]     message sizes in bytes, with optional suffix K or M
+//                              (default: 1,8,64,512,4K,64K,1M,64M)
+//   --min-time=MS              minimum measuring time per result in milliseconds (default: 20)
+//   --cold-pool=SIZE           memory the cold-cache messages are spread over (default: 256M)
+//   --format=csv|json          output format (default: csv)
+//
+// Each combination is measured with aligned (64 bytes) and misaligned
+// (offset by one byte) input and with warm and cold caches. Warm runs
+// checksum the same message repeatedly. Cold runs cycle through copies
+// of the message placed in random order over a pool much larger than
+// the caches. The results give the time per call and the throughput,
+// together with the memory of the lookup tables of the engine for the
+// algorithm (table_bytes), so that footprint and speed can be compared.
+//
+// The batch engine checksums groups of 16 messages in one call of
+// crc_batch, while the other engines are called once per message. So
+// batch compared with default shows what the batch engine gains over a
+// loop of calls. For all engines, calls and ns_per_call count messages.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <crc_catalog.h>
+#include <crc_catalog_registry.h>
+
+namespace
+{
+  using crc_benchmark_function       = std::uint64_t(*)(const std::uint8_t*, const std::size_t);
+  using crc_benchmark_batch_function = std::uint64_t(*)(const std::uint8_t* const*, const std::size_t);
+
+  constexpr std::size_t crc_benchmark_engine_count = 8U;
+
+  constexpr std::size_t crc_benchmark_engine_clmul = 5U;
+
+  constexpr std::size_t crc_benchmark_batch_count = 16U;
+
+  constexpr std::array<const char*, crc_benchmark_engine_count> crc_benchmark_engine_names =
+  {{
+    "bitwise", "nibble", "nibble_pair", "table", "slicing", "clmul", "default", "batch"
+  }};
+
+  // An engine checksums either one message per call (checksum)
+  // or crc_benchmark_batch_count messages per call (batch).
+  struct crc_benchmark_engine
+  {
+    crc_benchmark_function       checksum;
+    crc_benchmark_batch_function batch;
+    std::size_t                  table_size;
+  };
+
+  using crc_benchmark_engines = std::array<crc_benchmark_engine, crc_benchmark_engine_count>;
+
+  // The engines of an algorithm, together with its catalog name.
+  struct crc_benchmark_algorithm
+  {
+    const char*           name;
+    crc_benchmark_engines engines;
+  };
+
+  template<typename Params,
+           typename EnginePolicy>
+  std::uint64_t crc_benchmark_checksum(const std::uint8_t* message, const std::size_t count)
+  {
+    return std::uint64_t(crc::catalog::crc_engine<Params, EnginePolicy>::checksum(message, count));
+  }
+
+  template<typename Params,
+           typename EnginePolicy>
+  crc_benchmark_engine crc_benchmark_engine_make()
+  {
+    return { crc_benchmark_checksum<Params, EnginePolicy>, nullptr, crc::catalog::crc_engine<Params, EnginePolicy>::table_size() };
+  }
+
+  template<typename Params>
+  std::uint64_t crc_benchmark_batch(const std::uint8_t* const* messages, const std::size_t count)
+  {
+    std::array<std::size_t, crc_benchmark_batch_count> counts;
+
+    std::array<typename Params::value_type, crc_benchmark_batch_count> results;
+
+    counts.fill(count);
+
+    crc::catalog::crc_batch<Params>(messages, counts.data(), crc_benchmark_batch_count, results.data());
+
+    std::uint64_t result = 0U;
+
+    for(const typename Params::value_type& value : results)
+    {
+      result += std::uint64_t(value);
+    }
+
+    return result;
+  }
+
+  template<typename Params>
+  crc_benchmark_algorithm crc_benchmark_algorithm_make()
+  {
+    return
+    {
+      Params::name(),
+      {{
+        crc_benchmark_engine_make<Params, crc::catalog::crc_bitwise_policy>(),
+        crc_benchmark_engine_make<Params, crc::catalog::crc_nibble_policy>(),
+        crc_benchmark_engine_make<Params, crc::catalog::crc_nibble_pair_policy>(),
+        crc_benchmark_engine_make<Params, crc::catalog::crc_table_policy>(),
+        crc_benchmark_engine_make<Params, crc::catalog::crc_slicing_policy<>>(),
+        crc_benchmark_engine_make<Params, crc::catalog::crc_clmul_policy>(),
+        crc_benchmark_engine_make<Params, crc::catalog::crc_default_policy>(),
+        { nullptr, crc_benchmark_batch<Params>, crc::catalog::crc_engine<Params, crc::catalog::crc_slicing_policy<>>::table_size() }
+      }}
+    };
+  }
+
+  // The engines of the algorithms, in the order of the registry (which
+  // crc_benchmark_algorithms_match_registry() checks).
+  const std::vector<crc_benchmark_algorithm>& crc_benchmark_algorithms()
+  {
+    static const std::vector<crc_benchmark_algorithm> algorithms =
+    {
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc03_gsm_params         >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc03_rohc_params        >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc04_interlaken_params  >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc04_itu_params         >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc05_epc_params         >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc05_itu_params         >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc05_usb_params         >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc06_cdma2000_a_params  >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc06_cdma2000_b_params  >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc06_darc_params        >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc06_gsm_params         >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc06_itu_params         >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc07_params             >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc07_rohc_params        >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc07_umts_params        >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc08_params             >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc08_autosar_params     >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc08_bluetooth_params   >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc08_cdma2000_params    >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc08_darc_params        >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc08_dvb_s2_params      >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc08_ebu_params         >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc08_gsm_a_params       >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc08_gsm_b_params       >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc08_i_code_params      >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc08_itu_params         >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc08_lte_params         >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc08_maxim_params       >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc08_opensafety_params  >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc08_rohc_params        >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc08_sae_j1850_params   >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc08_wcdma_params       >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc10_params             >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc10_cdma2000_params    >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc10_gsm_params         >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc11_params             >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc11_umts_params        >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc12_cdma2000_params    >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc12_dect_params        >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc12_gsm_params         >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc12_umts_params        >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc13_bbc_params         >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc14_darc_params        >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc14_gsm_params         >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc15_params             >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc15_mpt1327_params     >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_arc_params         >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_aug_ccitt_params   >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_buypass_params     >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_ccitt_false_params >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_cdma2000_params    >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_cms_params         >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_dds_110_params     >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_dect_r_params      >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_dect_x_params      >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_dnp_params         >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_en_13757_params    >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_genibus_params     >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_gsm_params         >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_lj1200_params      >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_maxim_params       >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_mcrf4xx_params     >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_opensafety_a_params>(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_opensafety_b_params>(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_profibus_params    >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_riello_params      >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_t10_dif_params     >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_teledisk_params    >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_tms37157_params    >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_usb_params         >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_a_params           >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_kermit_params      >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_modbus_params      >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_x_25_params        >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc16_xmodem_params      >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc17_can_fd_params      >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc21_can_fd_params      >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc24_params             >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc24_ble_params         >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc24_flexray_a_params   >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc24_flexray_b_params   >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc24_interlaken_params  >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc24_lte_a_params       >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc24_lte_b_params       >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc30_cdma_params        >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc31_philips_params     >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc32_params             >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc32_autosar_params     >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc32_bzip2_params       >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc32_c_params           >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc32_d_params           >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc32_mpeg_2_params      >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc32_posix_params       >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc32_q_params           >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc32_jamcrc_params      >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc32_xfer_params        >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc40_gsm_params         >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc64_params             >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc64_go_iso_params      >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc64_we_params          >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc64_xz_params          >(),
+      crc_benchmark_algorithm_make<crc::catalog::crc_crc64_jones_redis_params >()
+    };
+
+    return algorithms;
+  }
+
+  bool crc_benchmark_algorithms_match_registry()
+  {
+    if(crc_benchmark_algorithms().size() != crc::catalog::crc_algorithm_count)
+    {
+      return false;
+    }
+
+    for(std::size_t index = 0U; index < crc::catalog::crc_algorithm_count; ++index)
+    {
+      if(std::string(crc_benchmark_algorithms()[index].name) != crc::catalog::crc_algorithms()[index].name)
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  bool crc_benchmark_clmul_is_available()
+  {
+    #if defined(CRC_CATALOG_HAS_CLMUL)
+    return crc::catalog::detail::crc_clmul_is_supported();
+    #else
+    return false;
+    #endif
+  }
+
+  struct crc_benchmark_options
+  {
+    std::vector<std::size_t> algorithms;
+    std::vector<std::size_t> engines;
+    std::vector<std::size_t> sizes;
+    double                   min_seconds    = 0.02;
+    std::size_t              cold_pool_size = std::size_t(256U) << 20U;
+    bool                     format_is_json = false;
+  };
+
+  std::vector<std::string> crc_benchmark_split(const std::string& text)
+  {
+    std::vector<std::string> parts;
+
+    std::istringstream text_stream(text);
+
+    for(std::string part; std::getline(text_stream, part, ','); )
+    {
+      parts.push_back(part);
+    }
+
+    return parts;
+  }
+
+  bool crc_benchmark_parse_size(const std::string& text, std::size_t& size)
+  {
+    char* text_end = nullptr;
+
+    const unsigned long long value = std::strtoull(text.c_str(), &text_end, 10);
+
+    const std::string suffix(text_end);
+
+    unsigned shift = 0U;
+
+    if     ((suffix == "K") || (suffix == "k")) { shift = 10U; }
+    else if((suffix == "M") || (suffix == "m")) { shift = 20U; }
+    else if(suffix.empty() == false)            { return false; }
+
+    size = std::size_t(value << shift);
+
+    return (text_end != text.c_str());
+  }
+
+  bool crc_benchmark_parse(int argc, char* argv[], crc_benchmark_options& options)
+  {
+    for(int arg_index = 1; arg_index < argc; ++arg_index)
+    {
+      const std::string argument(argv[arg_index]);
+
+      const std::string::size_type equals_position = argument.find('=');
+
+      const std::string key   = argument.substr(0U, equals_position);
+      const std::string value = ((equals_position != std::string::npos) ? argument.substr(equals_position + 1U) : std::string());
+
+      if(key == "--algorithm")
+      {
+        for(const std::string& name : crc_benchmark_split(value))
+        {
+          const crc::catalog::crc_algorithm* algorithm = crc::catalog::crc_find_algorithm(name.c_str());
+
+          if(algorithm == nullptr)
+          {
+            std::cerr << "Unknown algorithm: " << name << std::endl;
+
+            return false;
+          }
+
+          options.algorithms.push_back(std::size_t(algorithm->id));
+        }
+      }
+      else if(key == "--engine")
+      {
+        for(const std::string& name : crc_benchmark_split(value))
+        {
+          const auto engine_name = std::find(crc_benchmark_engine_names.cbegin(), crc_benchmark_engine_names.cend(), name);
+
+          if(engine_name == crc_benchmark_engine_names.cend())
+          {
+            std::cerr << "Unknown engine: " << name << std::endl;
+
+            return false;
+          }
+
+          options.engines.push_back(std::size_t(engine_name - crc_benchmark_engine_names.cbegin()));
+        }
+      }
+      else if(key == "--sizes")
+      {
+        for(const std::string& text : crc_benchmark_split(value))
+        {
+          std::size_t size = 0U;
+
+          if((crc_benchmark_parse_size(text, size) == false) || (size == 0U))
+          {
+            std::cerr << "Invalid size: " << text << std::endl;
+
+            return false;
+          }
+
+          options.sizes.push_back(size);
+        }
+      }
+      else if(key == "--min-time")
+      {
+        options.min_seconds = std::strtod(value.c_str(), nullptr) / 1000.0;
+      }
+      else if(key == "--cold-pool")
+      {
+        if(crc_benchmark_parse_size(value, options.cold_pool_size) == false)
+        {
+          std::cerr << "Invalid size: " << value << std::endl;
+
+          return false;
+        }
+      }
+      else if((key == "--format") && ((value == "csv") || (value == "json")))
+      {
+        options.format_is_json = (value == "json");
+      }
+      else
+      {
+        std::cerr << "Unknown option: " << argument << std::endl;
+
+        return false;
+      }
+    }
+
+    if(options.algorithms.empty())
+    {
+      for(std::size_t index = 0U; index < crc::catalog::crc_algorithm_count; ++index)
+      {
+        options.algorithms.push_back(index);
+      }
+    }
+
+    if(options.engines.empty())
+    {
+      for(std::size_t index = 0U; index < crc_benchmark_engine_count; ++index)
+      {
+        options.engines.push_back(index);
+      }
+    }
+
+    if(options.sizes.empty())
+    {
+      options.sizes = { 1U, 8U, 64U, 512U, 4096U, 65536U, std::size_t(1U) << 20U, std::size_t(64U) << 20U };
+    }
+
+    // Skip the folding engine where the processor lacks it.
+    if(crc_benchmark_clmul_is_available() == false)
+    {
+      options.engines.erase(std::remove(options.engines.begin(), options.engines.end(), crc_benchmark_engine_clmul),
+                            options.engines.end());
+    }
+
+    return true;
+  }
+
+  // Call the engine for the messages in turn, doubling the number
+  // of calls until the minimum time is reached. Returns the number
+  // of messages and their total time in seconds.
+  std::pair<std::uint64_t, double> crc_benchmark_measure(const crc_benchmark_engine&             engine,
+                                                         const std::vector<const std::uint8_t*>& messages,
+                                                         const std::size_t                       size,
+                                                         const double                            min_seconds,
+                                                         std::uint64_t&                          sink)
+  {
+    const std::size_t message_count = ((engine.batch != nullptr) ? crc_benchmark_batch_count : 1U);
+
+    const auto call =
+      [&engine, size](const std::uint8_t* const* call_messages) -> std::uint64_t
+      {
+        return ((engine.batch != nullptr) ? engine.batch(call_messages, size) : engine.checksum(call_messages[0U], size));
+      };
+
+    // An untimed call to warm up the code (and, for warm runs, the data).
+    sink += call(messages.data());
+
+    std::size_t message_index = 0U;
+
+    for(std::uint64_t call_count = 1U; ; call_count *= 2U)
+    {
+      const auto start = std::chrono::steady_clock::now();
+
+      for(std::uint64_t call_index = 0U; call_index < call_count; ++call_index)
+      {
+        sink += call(messages.data() + message_index);
+
+        message_index += message_count;
+
+        if((message_index + message_count) > messages.size())
+        {
+          message_index = 0U;
+        }
+      }
+
+      const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+      if(seconds >= min_seconds)
+      {
+        return std::make_pair(call_count * message_count, seconds);
+      }
+    }
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  if(crc_benchmark_algorithms_match_registry() == false)
+  {
+    std::cerr << "The algorithms of the benchmark do not match the registry." << std::endl;
+
+    return -1;
+  }
+
+  crc_benchmark_options options;
+
+  if(crc_benchmark_parse(argc, argv, options) == false)
+  {
+    return -1;
+  }
+
+  const std::size_t max_size = *std::max_element(options.sizes.cbegin(), options.sizes.cend());
+
+  // One pool of random bytes serves all of the messages.
+  const std::size_t pool_size = (std::max)(options.cold_pool_size, std::size_t(2U * (max_size + 128U)));
+
+  std::vector<std::uint8_t> pool(pool_size + 64U);
+
+  std::mt19937 generator(UINT32_C(0x5EED1234));
+
+  std::generate(pool.begin(), pool.end(), [&generator]() { return std::uint8_t(generator()); });
+
+  const std::uint8_t* pool_begin =
+    pool.data() + ((64U - (reinterpret_cast<std::uintptr_t>(pool.data()) % 64U)) % 64U);
+
+  std::uint64_t sink = 0U;
+
+  bool is_first_result = true;
+
+  if(options.format_is_json)
+  {
+    std::cout << "{\"results\":[" << std::endl;
+  }
+  else
+  {
+    std::cout << "algorithm,engine,table_bytes,size,alignment,cache,calls,ns_per_call,gb_per_s" << std::endl;
+  }
+
+  for(const std::size_t algorithm_index : options.algorithms)
+  {
+    const crc::catalog::crc_algorithm& algorithm =
+      crc::catalog::crc_find_algorithm(static_cast<crc::catalog::crc_algorithm_id>(algorithm_index));
+
+    for(const std::size_t engine_index : options.engines)
+    {
+      const crc_benchmark_engine& engine = crc_benchmark_algorithms()[algorithm_index].engines[engine_index];
+
+      for(const std::size_t size : options.sizes)
+      {
+        for(const std::size_t misalignment : { std::size_t(0U), std::size_t(1U) })
+        {
+          for(const bool cache_is_cold : { false, true })
+          {
+            std::vector<const std::uint8_t*> messages;
+
+            if(cache_is_cold)
+            {
+              // Slots of the message size (rounded up to cache lines) in random order.
+              const std::size_t slot_size  = ((size + misalignment + 63U) / 64U) * 64U;
+              const std::size_t slot_count = pool_size / slot_size;
+
+              for(std::size_t slot = 0U; slot < slot_count; ++slot)
+              {
+                messages.push_back(pool_begin + (slot * slot_size) + misalignment);
+              }
+
+              std::shuffle(messages.begin(), messages.end(), generator);
+            }
+            else
+            {
+              messages.push_back(pool_begin + misalignment);
+            }
+
+            // At least one group of messages for the batch engine.
+            for(std::size_t index = 0U; messages.size() < crc_benchmark_batch_count; ++index)
+            {
+              messages.push_back(messages[index]);
+            }
+
+            const std::pair<std::uint64_t, double> measurement =
+              crc_benchmark_measure(engine, messages, size, options.min_seconds, sink);
+
+            const double ns_per_call = (measurement.second * 1.0E9) / double(measurement.first);
+            const double gb_per_s    = double(size) / ns_per_call;
+
+            const char* alignment_name = ((misalignment == 0U) ? "aligned" : "misaligned");
+            const char* cache_name     = (cache_is_cold ? "cold" : "warm");
+
+            std::ostringstream result;
+
+            result << std::setprecision(6);
+
+            if(options.format_is_json)
+            {
+              result << (is_first_result ? "" : ",\n")
+                     << "{\"algorithm\":\""  << algorithm.name
+                     << "\",\"engine\":\""   << crc_benchmark_engine_names[engine_index]
+                     << "\",\"table_bytes\":" << engine.table_size
+                     << ",\"size\":"          << size
+                     << ",\"alignment\":\""  << alignment_name
+                     << "\",\"cache\":\""    << cache_name
+                     << "\",\"calls\":"      << measurement.first
+                     << ",\"ns_per_call\":"  << ns_per_call
+                     << ",\"gb_per_s\":"     << gb_per_s
+                     << "}";
+
+              std::cout << result.str() << std::flush;
+            }
+            else
+            {
+              result << algorithm.name
+                     << ',' << crc_benchmark_engine_names[engine_index]
+                     << ',' << engine.table_size
+                     << ',' << size
+                     << ',' << alignment_name
+                     << ',' << cache_name
+                     << ',' << measurement.first
+                     << ',' << ns_per_call
+                     << ',' << gb_per_s;
+
+              std::cout << result.str() << std::endl;
+            }
+
+            is_first_result = false;
+          }
+        }
+      }
+    }
+  }
+
+  if(options.format_is_json)
+  {
+    std::cout << "\n]}" << std::endl;
+  }
+
+  // Use the results, so that the computations can not be optimized away.
+  std::cerr << "checksum of the results: " << std::hex << sink << std::endl;
+}
@@ -5,8 +5,16 @@
 //  or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
 
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <new>
+
 #include <crc_catalog.h>
 #include <crc_catalog_c.h>
+#include <crc_catalog_redis.h>
+#include <crc_catalog_registry.h>
+#include <crc_catalog_stats.h>
 
 extern "C" uint8_t  crc_crc03_gsm         (const uint8_t* message, const size_t count) { return crc::catalog::crc_crc03_gsm         (message, count); }
 extern "C" uint8_t  crc_crc03_rohc        (const uint8_t* message, const size_t count) { return crc::catalog::crc_crc03_rohc        (message, count); }
@@ -110,3 +118,554 @@ extern "C" uint64_t crc_crc64_go_iso      (const uint8_t* message, const size_t
 extern "C" uint64_t crc_crc64_we          (const uint8_t* message, const size_t count) { return crc::catalog::crc_crc64_we          (message, count); }
 extern "C" uint64_t crc_crc64_xz          (const uint8_t* message, const size_t count) { return crc::catalog::crc_crc64_xz          (message, count); }
 extern "C" uint64_t crc_crc64_jones_redis (const uint8_t* message, const size_t count) { return crc::catalog::crc_crc64_jones_redis (message, count); }
+
+extern "C" uint8_t  crc_crc03_gsm_combine         (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc03_gsm_combine         (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc03_rohc_combine        (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc03_rohc_combine        (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc04_interlaken_combine  (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc04_interlaken_combine  (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc04_itu_combine         (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc04_itu_combine         (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc05_epc_combine         (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc05_epc_combine         (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc05_itu_combine         (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc05_itu_combine         (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc05_usb_combine         (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc05_usb_combine         (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc06_cdma2000_a_combine  (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc06_cdma2000_a_combine  (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc06_cdma2000_b_combine  (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc06_cdma2000_b_combine  (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc06_darc_combine        (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc06_darc_combine        (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc06_gsm_combine         (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc06_gsm_combine         (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc06_itu_combine         (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc06_itu_combine         (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc07_combine             (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc07_combine             (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc07_rohc_combine        (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc07_rohc_combine        (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc07_umts_combine        (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc07_umts_combine        (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc08_combine             (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc08_combine             (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc08_autosar_combine     (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc08_autosar_combine     (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc08_bluetooth_combine   (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc08_bluetooth_combine   (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc08_cdma2000_combine    (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc08_cdma2000_combine    (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc08_darc_combine        (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc08_darc_combine        (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc08_dvb_s2_combine      (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc08_dvb_s2_combine      (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc08_ebu_combine         (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc08_ebu_combine         (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc08_gsm_a_combine       (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc08_gsm_a_combine       (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc08_gsm_b_combine       (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc08_gsm_b_combine       (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc08_i_code_combine      (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc08_i_code_combine      (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc08_itu_combine         (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc08_itu_combine         (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc08_lte_combine         (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc08_lte_combine         (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc08_maxim_combine       (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc08_maxim_combine       (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc08_opensafety_combine  (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc08_opensafety_combine  (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc08_rohc_combine        (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc08_rohc_combine        (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc08_sae_j1850_combine   (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc08_sae_j1850_combine   (crc_a, crc_b, length_b); }
+extern "C" uint8_t  crc_crc08_wcdma_combine       (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b) { return crc::catalog::crc_crc08_wcdma_combine       (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc10_combine             (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc10_combine             (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc10_cdma2000_combine    (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc10_cdma2000_combine    (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc10_gsm_combine         (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc10_gsm_combine         (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc11_combine             (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc11_combine             (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc11_umts_combine        (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc11_umts_combine        (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc12_cdma2000_combine    (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc12_cdma2000_combine    (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc12_dect_combine        (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc12_dect_combine        (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc12_gsm_combine         (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc12_gsm_combine         (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc12_umts_combine        (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc12_umts_combine        (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc13_bbc_combine         (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc13_bbc_combine         (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc14_darc_combine        (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc14_darc_combine        (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc14_gsm_combine         (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc14_gsm_combine         (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc15_combine             (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc15_combine             (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc15_mpt1327_combine     (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc15_mpt1327_combine     (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_arc_combine         (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_arc_combine         (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_aug_ccitt_combine   (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_aug_ccitt_combine   (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_buypass_combine     (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_buypass_combine     (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_ccitt_false_combine (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_ccitt_false_combine (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_cdma2000_combine    (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_cdma2000_combine    (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_cms_combine         (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_cms_combine         (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_dds_110_combine     (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_dds_110_combine     (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_dect_r_combine      (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_dect_r_combine      (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_dect_x_combine      (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_dect_x_combine      (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_dnp_combine         (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_dnp_combine         (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_en_13757_combine    (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_en_13757_combine    (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_genibus_combine     (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_genibus_combine     (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_gsm_combine         (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_gsm_combine         (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_lj1200_combine      (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_lj1200_combine      (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_maxim_combine       (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_maxim_combine       (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_mcrf4xx_combine     (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_mcrf4xx_combine     (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_opensafety_a_combine(const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_opensafety_a_combine(crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_opensafety_b_combine(const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_opensafety_b_combine(crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_profibus_combine    (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_profibus_combine    (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_riello_combine      (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_riello_combine      (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_t10_dif_combine     (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_t10_dif_combine     (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_teledisk_combine    (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_teledisk_combine    (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_tms37157_combine    (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_tms37157_combine    (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_usb_combine         (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_usb_combine         (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_a_combine           (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_a_combine           (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_kermit_combine      (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_kermit_combine      (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_modbus_combine      (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_modbus_combine      (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_x_25_combine        (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_x_25_combine        (crc_a, crc_b, length_b); }
+extern "C" uint16_t crc_crc16_xmodem_combine      (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc16_xmodem_combine      (crc_a, crc_b, length_b); }
+extern "C" uint32_t crc_crc17_can_fd_combine      (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc17_can_fd_combine      (crc_a, crc_b, length_b); }
+extern "C" uint32_t crc_crc21_can_fd_combine      (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc21_can_fd_combine      (crc_a, crc_b, length_b); }
+extern "C" uint32_t crc_crc24_combine             (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc24_combine             (crc_a, crc_b, length_b); }
+extern "C" uint32_t crc_crc24_ble_combine         (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc24_ble_combine         (crc_a, crc_b, length_b); }
+extern "C" uint32_t crc_crc24_flexray_a_combine   (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc24_flexray_a_combine   (crc_a, crc_b, length_b); }
+extern "C" uint32_t crc_crc24_flexray_b_combine   (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc24_flexray_b_combine   (crc_a, crc_b, length_b); }
+extern "C" uint32_t crc_crc24_interlaken_combine  (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc24_interlaken_combine  (crc_a, crc_b, length_b); }
+extern "C" uint32_t crc_crc24_lte_a_combine       (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc24_lte_a_combine       (crc_a, crc_b, length_b); }
+extern "C" uint32_t crc_crc24_lte_b_combine       (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc24_lte_b_combine       (crc_a, crc_b, length_b); }
+extern "C" uint32_t crc_crc30_cdma_combine        (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc30_cdma_combine        (crc_a, crc_b, length_b); }
+extern "C" uint32_t crc_crc31_philips_combine     (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc31_philips_combine     (crc_a, crc_b, length_b); }
+extern "C" uint32_t crc_crc32_combine             (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc32_combine             (crc_a, crc_b, length_b); }
+extern "C" uint32_t crc_crc32_autosar_combine     (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc32_autosar_combine     (crc_a, crc_b, length_b); }
+extern "C" uint32_t crc_crc32_bzip2_combine       (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc32_bzip2_combine       (crc_a, crc_b, length_b); }
+extern "C" uint32_t crc_crc32_c_combine           (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc32_c_combine           (crc_a, crc_b, length_b); }
+extern "C" uint32_t crc_crc32_d_combine           (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc32_d_combine           (crc_a, crc_b, length_b); }
+extern "C" uint32_t crc_crc32_mpeg_2_combine      (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc32_mpeg_2_combine      (crc_a, crc_b, length_b); }
+extern "C" uint32_t crc_crc32_posix_combine       (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc32_posix_combine       (crc_a, crc_b, length_b); }
+extern "C" uint32_t crc_crc32_q_combine           (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc32_q_combine           (crc_a, crc_b, length_b); }
+extern "C" uint32_t crc_crc32_jamcrc_combine      (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc32_jamcrc_combine      (crc_a, crc_b, length_b); }
+extern "C" uint32_t crc_crc32_xfer_combine        (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc32_xfer_combine        (crc_a, crc_b, length_b); }
+extern "C" uint64_t crc_crc40_gsm_combine         (const uint64_t crc_a, const uint64_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc40_gsm_combine         (crc_a, crc_b, length_b); }
+extern "C" uint64_t crc_crc64_combine             (const uint64_t crc_a, const uint64_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc64_combine             (crc_a, crc_b, length_b); }
+extern "C" uint64_t crc_crc64_go_iso_combine      (const uint64_t crc_a, const uint64_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc64_go_iso_combine      (crc_a, crc_b, length_b); }
+extern "C" uint64_t crc_crc64_we_combine          (const uint64_t crc_a, const uint64_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc64_we_combine          (crc_a, crc_b, length_b); }
+extern "C" uint64_t crc_crc64_xz_combine          (const uint64_t crc_a, const uint64_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc64_xz_combine          (crc_a, crc_b, length_b); }
+extern "C" uint64_t crc_crc64_jones_redis_combine (const uint64_t crc_a, const uint64_t crc_b, const uint64_t length_b) { return crc::catalog::crc_crc64_jones_redis_combine (crc_a, crc_b, length_b); }
+
+struct crc_context
+{
+  virtual ~crc_context() = default;
+
+  virtual void     update  (const std::uint8_t* message, const std::size_t count) = 0;
+  virtual uint64_t finalize() const = 0;
+  virtual void     reset   () = 0;
+};
+
+namespace
+{
+  template<typename Params>
+  struct crc_context_of_params : public crc_context
+  {
+    crc::catalog::crc_engine<Params> my_engine;
+
+    void     update  (const std::uint8_t* message, const std::size_t count) override { my_engine.update(message, count); }
+    uint64_t finalize() const override                                            { return uint64_t(my_engine.finalize()); }
+    void     reset   () override                                                  { my_engine.reset(); }
+  };
+
+  template<typename Params>
+  crc_context* crc_context_create()
+  {
+    return new(std::nothrow) crc_context_of_params<Params>();
+  }
+}
+
+extern "C" crc_context* crc_crc03_gsm_context_create         (void) { return crc_context_create<crc::catalog::crc_crc03_gsm_params         >(); }
+extern "C" crc_context* crc_crc03_rohc_context_create        (void) { return crc_context_create<crc::catalog::crc_crc03_rohc_params        >(); }
+extern "C" crc_context* crc_crc04_interlaken_context_create  (void) { return crc_context_create<crc::catalog::crc_crc04_interlaken_params  >(); }
+extern "C" crc_context* crc_crc04_itu_context_create         (void) { return crc_context_create<crc::catalog::crc_crc04_itu_params         >(); }
+extern "C" crc_context* crc_crc05_epc_context_create         (void) { return crc_context_create<crc::catalog::crc_crc05_epc_params         >(); }
+extern "C" crc_context* crc_crc05_itu_context_create         (void) { return crc_context_create<crc::catalog::crc_crc05_itu_params         >(); }
+extern "C" crc_context* crc_crc05_usb_context_create         (void) { return crc_context_create<crc::catalog::crc_crc05_usb_params         >(); }
+extern "C" crc_context* crc_crc06_cdma2000_a_context_create  (void) { return crc_context_create<crc::catalog::crc_crc06_cdma2000_a_params  >(); }
+extern "C" crc_context* crc_crc06_cdma2000_b_context_create  (void) { return crc_context_create<crc::catalog::crc_crc06_cdma2000_b_params  >(); }
+extern "C" crc_context* crc_crc06_darc_context_create        (void) { return crc_context_create<crc::catalog::crc_crc06_darc_params        >(); }
+extern "C" crc_context* crc_crc06_gsm_context_create         (void) { return crc_context_create<crc::catalog::crc_crc06_gsm_params         >(); }
+extern "C" crc_context* crc_crc06_itu_context_create         (void) { return crc_context_create<crc::catalog::crc_crc06_itu_params         >(); }
+extern "C" crc_context* crc_crc07_context_create             (void) { return crc_context_create<crc::catalog::crc_crc07_params             >(); }
+extern "C" crc_context* crc_crc07_rohc_context_create        (void) { return crc_context_create<crc::catalog::crc_crc07_rohc_params        >(); }
+extern "C" crc_context* crc_crc07_umts_context_create        (void) { return crc_context_create<crc::catalog::crc_crc07_umts_params        >(); }
+extern "C" crc_context* crc_crc08_context_create             (void) { return crc_context_create<crc::catalog::crc_crc08_params             >(); }
+extern "C" crc_context* crc_crc08_autosar_context_create     (void) { return crc_context_create<crc::catalog::crc_crc08_autosar_params     >(); }
+extern "C" crc_context* crc_crc08_bluetooth_context_create   (void) { return crc_context_create<crc::catalog::crc_crc08_bluetooth_params   >(); }
+extern "C" crc_context* crc_crc08_cdma2000_context_create    (void) { return crc_context_create<crc::catalog::crc_crc08_cdma2000_params    >(); }
+extern "C" crc_context* crc_crc08_darc_context_create        (void) { return crc_context_create<crc::catalog::crc_crc08_darc_params        >(); }
+extern "C" crc_context* crc_crc08_dvb_s2_context_create      (void) { return crc_context_create<crc::catalog::crc_crc08_dvb_s2_params      >(); }
+extern "C" crc_context* crc_crc08_ebu_context_create         (void) { return crc_context_create<crc::catalog::crc_crc08_ebu_params         >(); }
+extern "C" crc_context* crc_crc08_gsm_a_context_create       (void) { return crc_context_create<crc::catalog::crc_crc08_gsm_a_params       >(); }
+extern "C" crc_context* crc_crc08_gsm_b_context_create       (void) { return crc_context_create<crc::catalog::crc_crc08_gsm_b_params       >(); }
+extern "C" crc_context* crc_crc08_i_code_context_create      (void) { return crc_context_create<crc::catalog::crc_crc08_i_code_params      >(); }
+extern "C" crc_context* crc_crc08_itu_context_create         (void) { return crc_context_create<crc::catalog::crc_crc08_itu_params         >(); }
+extern "C" crc_context* crc_crc08_lte_context_create         (void) { return crc_context_create<crc::catalog::crc_crc08_lte_params         >(); }
+extern "C" crc_context* crc_crc08_maxim_context_create       (void) { return crc_context_create<crc::catalog::crc_crc08_maxim_params       >(); }
+extern "C" crc_context* crc_crc08_opensafety_context_create  (void) { return crc_context_create<crc::catalog::crc_crc08_opensafety_params  >(); }
+extern "C" crc_context* crc_crc08_rohc_context_create        (void) { return crc_context_create<crc::catalog::crc_crc08_rohc_params        >(); }
+extern "C" crc_context* crc_crc08_sae_j1850_context_create   (void) { return crc_context_create<crc::catalog::crc_crc08_sae_j1850_params   >(); }
+extern "C" crc_context* crc_crc08_wcdma_context_create       (void) { return crc_context_create<crc::catalog::crc_crc08_wcdma_params       >(); }
+extern "C" crc_context* crc_crc10_context_create             (void) { return crc_context_create<crc::catalog::crc_crc10_params             >(); }
+extern "C" crc_context* crc_crc10_cdma2000_context_create    (void) { return crc_context_create<crc::catalog::crc_crc10_cdma2000_params    >(); }
+extern "C" crc_context* crc_crc10_gsm_context_create         (void) { return crc_context_create<crc::catalog::crc_crc10_gsm_params         >(); }
+extern "C" crc_context* crc_crc11_context_create             (void) { return crc_context_create<crc::catalog::crc_crc11_params             >(); }
+extern "C" crc_context* crc_crc11_umts_context_create        (void) { return crc_context_create<crc::catalog::crc_crc11_umts_params        >(); }
+extern "C" crc_context* crc_crc12_cdma2000_context_create    (void) { return crc_context_create<crc::catalog::crc_crc12_cdma2000_params    >(); }
+extern "C" crc_context* crc_crc12_dect_context_create        (void) { return crc_context_create<crc::catalog::crc_crc12_dect_params        >(); }
+extern "C" crc_context* crc_crc12_gsm_context_create         (void) { return crc_context_create<crc::catalog::crc_crc12_gsm_params         >(); }
+extern "C" crc_context* crc_crc12_umts_context_create        (void) { return crc_context_create<crc::catalog::crc_crc12_umts_params        >(); }
+extern "C" crc_context* crc_crc13_bbc_context_create         (void) { return crc_context_create<crc::catalog::crc_crc13_bbc_params         >(); }
+extern "C" crc_context* crc_crc14_darc_context_create        (void) { return crc_context_create<crc::catalog::crc_crc14_darc_params        >(); }
+extern "C" crc_context* crc_crc14_gsm_context_create         (void) { return crc_context_create<crc::catalog::crc_crc14_gsm_params         >(); }
+extern "C" crc_context* crc_crc15_context_create             (void) { return crc_context_create<crc::catalog::crc_crc15_params             >(); }
+extern "C" crc_context* crc_crc15_mpt1327_context_create     (void) { return crc_context_create<crc::catalog::crc_crc15_mpt1327_params     >(); }
+extern "C" crc_context* crc_crc16_arc_context_create         (void) { return crc_context_create<crc::catalog::crc_crc16_arc_params         >(); }
+extern "C" crc_context* crc_crc16_aug_ccitt_context_create   (void) { return crc_context_create<crc::catalog::crc_crc16_aug_ccitt_params   >(); }
+extern "C" crc_context* crc_crc16_buypass_context_create     (void) { return crc_context_create<crc::catalog::crc_crc16_buypass_params     >(); }
+extern "C" crc_context* crc_crc16_ccitt_false_context_create (void) { return crc_context_create<crc::catalog::crc_crc16_ccitt_false_params >(); }
+extern "C" crc_context* crc_crc16_cdma2000_context_create    (void) { return crc_context_create<crc::catalog::crc_crc16_cdma2000_params    >(); }
+extern "C" crc_context* crc_crc16_cms_context_create         (void) { return crc_context_create<crc::catalog::crc_crc16_cms_params         >(); }
+extern "C" crc_context* crc_crc16_dds_110_context_create     (void) { return crc_context_create<crc::catalog::crc_crc16_dds_110_params     >(); }
+extern "C" crc_context* crc_crc16_dect_r_context_create      (void) { return crc_context_create<crc::catalog::crc_crc16_dect_r_params      >(); }
+extern "C" crc_context* crc_crc16_dect_x_context_create      (void) { return crc_context_create<crc::catalog::crc_crc16_dect_x_params      >(); }
+extern "C" crc_context* crc_crc16_dnp_context_create         (void) { return crc_context_create<crc::catalog::crc_crc16_dnp_params         >(); }
+extern "C" crc_context* crc_crc16_en_13757_context_create    (void) { return crc_context_create<crc::catalog::crc_crc16_en_13757_params    >(); }
+extern "C" crc_context* crc_crc16_genibus_context_create     (void) { return crc_context_create<crc::catalog::crc_crc16_genibus_params     >(); }
+extern "C" crc_context* crc_crc16_gsm_context_create         (void) { return crc_context_create<crc::catalog::crc_crc16_gsm_params         >(); }
+extern "C" crc_context* crc_crc16_lj1200_context_create      (void) { return crc_context_create<crc::catalog::crc_crc16_lj1200_params      >(); }
+extern "C" crc_context* crc_crc16_maxim_context_create       (void) { return crc_context_create<crc::catalog::crc_crc16_maxim_params       >(); }
+extern "C" crc_context* crc_crc16_mcrf4xx_context_create     (void) { return crc_context_create<crc::catalog::crc_crc16_mcrf4xx_params     >(); }
+extern "C" crc_context* crc_crc16_opensafety_a_context_create(void) { return crc_context_create<crc::catalog::crc_crc16_opensafety_a_params>(); }
+extern "C" crc_context* crc_crc16_opensafety_b_context_create(void) { return crc_context_create<crc::catalog::crc_crc16_opensafety_b_params>(); }
+extern "C" crc_context* crc_crc16_profibus_context_create    (void) { return crc_context_create<crc::catalog::crc_crc16_profibus_params    >(); }
+extern "C" crc_context* crc_crc16_riello_context_create      (void) { return crc_context_create<crc::catalog::crc_crc16_riello_params      >(); }
+extern "C" crc_context* crc_crc16_t10_dif_context_create     (void) { return crc_context_create<crc::catalog::crc_crc16_t10_dif_params     >(); }
+extern "C" crc_context* crc_crc16_teledisk_context_create    (void) { return crc_context_create<crc::catalog::crc_crc16_teledisk_params    >(); }
+extern "C" crc_context* crc_crc16_tms37157_context_create    (void) { return crc_context_create<crc::catalog::crc_crc16_tms37157_params    >(); }
+extern "C" crc_context* crc_crc16_usb_context_create         (void) { return crc_context_create<crc::catalog::crc_crc16_usb_params         >(); }
+extern "C" crc_context* crc_crc16_a_context_create           (void) { return crc_context_create<crc::catalog::crc_crc16_a_params           >(); }
+extern "C" crc_context* crc_crc16_kermit_context_create      (void) { return crc_context_create<crc::catalog::crc_crc16_kermit_params      >(); }
+extern "C" crc_context* crc_crc16_modbus_context_create      (void) { return crc_context_create<crc::catalog::crc_crc16_modbus_params      >(); }
+extern "C" crc_context* crc_crc16_x_25_context_create        (void) { return crc_context_create<crc::catalog::crc_crc16_x_25_params        >(); }
+extern "C" crc_context* crc_crc16_xmodem_context_create      (void) { return crc_context_create<crc::catalog::crc_crc16_xmodem_params      >(); }
+extern "C" crc_context* crc_crc17_can_fd_context_create      (void) { return crc_context_create<crc::catalog::crc_crc17_can_fd_params      >(); }
+extern "C" crc_context* crc_crc21_can_fd_context_create      (void) { return crc_context_create<crc::catalog::crc_crc21_can_fd_params      >(); }
+extern "C" crc_context* crc_crc24_context_create             (void) { return crc_context_create<crc::catalog::crc_crc24_params             >(); }
+extern "C" crc_context* crc_crc24_ble_context_create         (void) { return crc_context_create<crc::catalog::crc_crc24_ble_params         >(); }
+extern "C" crc_context* crc_crc24_flexray_a_context_create   (void) { return crc_context_create<crc::catalog::crc_crc24_flexray_a_params   >(); }
+extern "C" crc_context* crc_crc24_flexray_b_context_create   (void) { return crc_context_create<crc::catalog::crc_crc24_flexray_b_params   >(); }
+extern "C" crc_context* crc_crc24_interlaken_context_create  (void) { return crc_context_create<crc::catalog::crc_crc24_interlaken_params  >(); }
+extern "C" crc_context* crc_crc24_lte_a_context_create       (void) { return crc_context_create<crc::catalog::crc_crc24_lte_a_params       >(); }
+extern "C" crc_context* crc_crc24_lte_b_context_create       (void) { return crc_context_create<crc::catalog::crc_crc24_lte_b_params       >(); }
+extern "C" crc_context* crc_crc30_cdma_context_create        (void) { return crc_context_create<crc::catalog::crc_crc30_cdma_params        >(); }
+extern "C" crc_context* crc_crc31_philips_context_create     (void) { return crc_context_create<crc::catalog::crc_crc31_philips_params     >(); }
+extern "C" crc_context* crc_crc32_context_create             (void) { return crc_context_create<crc::catalog::crc_crc32_params             >(); }
+extern "C" crc_context* crc_crc32_autosar_context_create     (void) { return crc_context_create<crc::catalog::crc_crc32_autosar_params     >(); }
+extern "C" crc_context* crc_crc32_bzip2_context_create       (void) { return crc_context_create<crc::catalog::crc_crc32_bzip2_params       >(); }
+extern "C" crc_context* crc_crc32_c_context_create           (void) { return crc_context_create<crc::catalog::crc_crc32_c_params           >(); }
+extern "C" crc_context* crc_crc32_d_context_create           (void) { return crc_context_create<crc::catalog::crc_crc32_d_params           >(); }
+extern "C" crc_context* crc_crc32_mpeg_2_context_create      (void) { return crc_context_create<crc::catalog::crc_crc32_mpeg_2_params      >(); }
+extern "C" crc_context* crc_crc32_posix_context_create       (void) { return crc_context_create<crc::catalog::crc_crc32_posix_params       >(); }
+extern "C" crc_context* crc_crc32_q_context_create           (void) { return crc_context_create<crc::catalog::crc_crc32_q_params           >(); }
+extern "C" crc_context* crc_crc32_jamcrc_context_create      (void) { return crc_context_create<crc::catalog::crc_crc32_jamcrc_params      >(); }
+extern "C" crc_context* crc_crc32_xfer_context_create        (void) { return crc_context_create<crc::catalog::crc_crc32_xfer_params        >(); }
+extern "C" crc_context* crc_crc40_gsm_context_create         (void) { return crc_context_create<crc::catalog::crc_crc40_gsm_params         >(); }
+extern "C" crc_context* crc_crc64_context_create             (void) { return crc_context_create<crc::catalog::crc_crc64_params             >(); }
+extern "C" crc_context* crc_crc64_go_iso_context_create      (void) { return crc_context_create<crc::catalog::crc_crc64_go_iso_params      >(); }
+extern "C" crc_context* crc_crc64_we_context_create          (void) { return crc_context_create<crc::catalog::crc_crc64_we_params          >(); }
+extern "C" crc_context* crc_crc64_xz_context_create          (void) { return crc_context_create<crc::catalog::crc_crc64_xz_params          >(); }
+extern "C" crc_context* crc_crc64_jones_redis_context_create (void) { return crc_context_create<crc::catalog::crc_crc64_jones_redis_params >(); }
+
+extern "C" void     crc_context_update  (crc_context* context, const uint8_t* message, const size_t count) { context->update(message, count); }
+extern "C" uint64_t crc_context_finalize(const crc_context* context)                                       { return context->finalize(); }
+extern "C" void     crc_context_reset   (crc_context* context)                                             { context->reset(); }
+extern "C" void     crc_context_destroy (crc_context* context)                                             { delete context; }
+
+extern "C" void crc_context_update_segments(crc_context* context, const crc_segment* segments, const size_t segment_count)
+{
+  for(std::size_t index = 0U; index < segment_count; ++index)
+  {
+    context->update(segments[index].data, segments[index].count);
+  }
+}
+
+namespace
+{
+  static_assert(std::size_t(crc_algorithm_unknown) == crc::catalog::crc_algorithm_count,
+                "Error: The C and C++ algorithm identifiers differ.");
+
+  using crc_context_create_function = crc_context*(*)(void);
+
+  constexpr crc_context_create_function crc_context_creators[crc::catalog::crc_algorithm_count] =
+  {
+    crc_crc03_gsm_context_create,
+    crc_crc03_rohc_context_create,
+    crc_crc04_interlaken_context_create,
+    crc_crc04_itu_context_create,
+    crc_crc05_epc_context_create,
+    crc_crc05_itu_context_create,
+    crc_crc05_usb_context_create,
+    crc_crc06_cdma2000_a_context_create,
+    crc_crc06_cdma2000_b_context_create,
+    crc_crc06_darc_context_create,
+    crc_crc06_gsm_context_create,
+    crc_crc06_itu_context_create,
+    crc_crc07_context_create,
+    crc_crc07_rohc_context_create,
+    crc_crc07_umts_context_create,
+    crc_crc08_context_create,
+    crc_crc08_autosar_context_create,
+    crc_crc08_bluetooth_context_create,
+    crc_crc08_cdma2000_context_create,
+    crc_crc08_darc_context_create,
+    crc_crc08_dvb_s2_context_create,
+    crc_crc08_ebu_context_create,
+    crc_crc08_gsm_a_context_create,
+    crc_crc08_gsm_b_context_create,
+    crc_crc08_i_code_context_create,
+    crc_crc08_itu_context_create,
+    crc_crc08_lte_context_create,
+    crc_crc08_maxim_context_create,
+    crc_crc08_opensafety_context_create,
+    crc_crc08_rohc_context_create,
+    crc_crc08_sae_j1850_context_create,
+    crc_crc08_wcdma_context_create,
+    crc_crc10_context_create,
+    crc_crc10_cdma2000_context_create,
+    crc_crc10_gsm_context_create,
+    crc_crc11_context_create,
+    crc_crc11_umts_context_create,
+    crc_crc12_cdma2000_context_create,
+    crc_crc12_dect_context_create,
+    crc_crc12_gsm_context_create,
+    crc_crc12_umts_context_create,
+    crc_crc13_bbc_context_create,
+    crc_crc14_darc_context_create,
+    crc_crc14_gsm_context_create,
+    crc_crc15_context_create,
+    crc_crc15_mpt1327_context_create,
+    crc_crc16_arc_context_create,
+    crc_crc16_aug_ccitt_context_create,
+    crc_crc16_buypass_context_create,
+    crc_crc16_ccitt_false_context_create,
+    crc_crc16_cdma2000_context_create,
+    crc_crc16_cms_context_create,
+    crc_crc16_dds_110_context_create,
+    crc_crc16_dect_r_context_create,
+    crc_crc16_dect_x_context_create,
+    crc_crc16_dnp_context_create,
+    crc_crc16_en_13757_context_create,
+    crc_crc16_genibus_context_create,
+    crc_crc16_gsm_context_create,
+    crc_crc16_lj1200_context_create,
+    crc_crc16_maxim_context_create,
+    crc_crc16_mcrf4xx_context_create,
+    crc_crc16_opensafety_a_context_create,
+    crc_crc16_opensafety_b_context_create,
+    crc_crc16_profibus_context_create,
+    crc_crc16_riello_context_create,
+    crc_crc16_t10_dif_context_create,
+    crc_crc16_teledisk_context_create,
+    crc_crc16_tms37157_context_create,
+    crc_crc16_usb_context_create,
+    crc_crc16_a_context_create,
+    crc_crc16_kermit_context_create,
+    crc_crc16_modbus_context_create,
+    crc_crc16_x_25_context_create,
+    crc_crc16_xmodem_context_create,
+    crc_crc17_can_fd_context_create,
+    crc_crc21_can_fd_context_create,
+    crc_crc24_context_create,
+    crc_crc24_ble_context_create,
+    crc_crc24_flexray_a_context_create,
+    crc_crc24_flexray_b_context_create,
+    crc_crc24_interlaken_context_create,
+    crc_crc24_lte_a_context_create,
+    crc_crc24_lte_b_context_create,
+    crc_crc30_cdma_context_create,
+    crc_crc31_philips_context_create,
+    crc_crc32_context_create,
+    crc_crc32_autosar_context_create,
+    crc_crc32_bzip2_context_create,
+    crc_crc32_c_context_create,
+    crc_crc32_d_context_create,
+    crc_crc32_mpeg_2_context_create,
+    crc_crc32_posix_context_create,
+    crc_crc32_q_context_create,
+    crc_crc32_jamcrc_context_create,
+    crc_crc32_xfer_context_create,
+    crc_crc40_gsm_context_create,
+    crc_crc64_context_create,
+    crc_crc64_go_iso_context_create,
+    crc_crc64_we_context_create,
+    crc_crc64_xz_context_create,
+    crc_crc64_jones_redis_context_create
+  };
+
+  const crc::catalog::crc_algorithm* crc_algorithm_of_id(const crc_algorithm_id id)
+  {
+    return ((std::size_t(id) < crc::catalog::crc_algorithm_count)
+             ? &crc::catalog::crc_find_algorithm(static_cast<crc::catalog::crc_algorithm_id>(id))
+             : nullptr);
+  }
+}
+
+extern "C" crc_algorithm_id crc_algorithm_find(const char* name)
+{
+  const crc::catalog::crc_algorithm* algorithm = crc::catalog::crc_find_algorithm(name);
+
+  return ((algorithm != nullptr) ? static_cast<crc_algorithm_id>(algorithm->id) : crc_algorithm_unknown);
+}
+
+extern "C" const char* crc_algorithm_name(const crc_algorithm_id id)
+{
+  const crc::catalog::crc_algorithm* algorithm = crc_algorithm_of_id(id);
+
+  return ((algorithm != nullptr) ? algorithm->name : nullptr);
+}
+
+extern "C" unsigned crc_algorithm_width(const crc_algorithm_id id)
+{
+  const crc::catalog::crc_algorithm* algorithm = crc_algorithm_of_id(id);
+
+  return ((algorithm != nullptr) ? unsigned(algorithm->number_of_bits) : 0U);
+}
+
+extern "C" uint64_t crc_algorithm_check(const crc_algorithm_id id)
+{
+  const crc::catalog::crc_algorithm* algorithm = crc_algorithm_of_id(id);
+
+  return ((algorithm != nullptr) ? algorithm->check : 0U);
+}
+
+extern "C" uint64_t crc_algorithm_checksum(const crc_algorithm_id id, const uint8_t* message, const size_t count)
+{
+  const crc::catalog::crc_algorithm* algorithm = crc_algorithm_of_id(id);
+
+  return ((algorithm != nullptr) ? algorithm->checksum(message, count) : 0U);
+}
+
+extern "C" uint64_t crc_algorithm_checksum_bits(const crc_algorithm_id id, const uint8_t* message, const size_t bits)
+{
+  const crc::catalog::crc_algorithm* algorithm = crc_algorithm_of_id(id);
+
+  return ((algorithm != nullptr) ? algorithm->checksum_bits(message, bits) : 0U);
+}
+
+extern "C" uint64_t crc_algorithm_gather(const crc_algorithm_id id, const crc_segment* segments, const size_t segment_count)
+{
+  const crc::catalog::crc_algorithm* algorithm = crc_algorithm_of_id(id);
+
+  if(algorithm == nullptr)
+  {
+    return 0U;
+  }
+
+  std::uint64_t crc_register = algorithm->initial_register;
+
+  for(std::size_t index = 0U; index < segment_count; ++index)
+  {
+    crc_register = algorithm->update(crc_register, segments[index].data, segments[index].count);
+  }
+
+  return algorithm->finalize(crc_register);
+}
+
+extern "C" uint64_t crc_algorithm_combine(const crc_algorithm_id id, const uint64_t crc_a, const uint64_t crc_b, const uint64_t length_b)
+{
+  const crc::catalog::crc_algorithm* algorithm = crc_algorithm_of_id(id);
+
+  return ((algorithm != nullptr) ? algorithm->combine(crc_a, crc_b, length_b) : 0U);
+}
+
+extern "C" uint64_t crc_algorithm_patch(const crc_algorithm_id id, const uint64_t crc, const uint64_t length, const uint64_t offset, const uint8_t* old_bytes, const uint8_t* new_bytes, const size_t count)
+{
+  const crc::catalog::crc_algorithm* algorithm = crc_algorithm_of_id(id);
+
+  return ((algorithm != nullptr) ? algorithm->patch(crc, length, offset, old_bytes, new_bytes, count) : 0U);
+}
+
+extern "C" size_t crc_algorithm_field_size(const crc_algorithm_id id)
+{
+  const crc::catalog::crc_algorithm* algorithm = crc_algorithm_of_id(id);
+
+  return ((algorithm != nullptr) ? algorithm->field_size : 0U);
+}
+
+extern "C" uint64_t crc_algorithm_append(const crc_algorithm_id id, uint8_t* message, const size_t count)
+{
+  const crc::catalog::crc_algorithm* algorithm = crc_algorithm_of_id(id);
+
+  return ((algorithm != nullptr) ? algorithm->append(message, count) : 0U);
+}
+
+extern "C" int crc_algorithm_verify(const crc_algorithm_id id, const uint8_t* message, const size_t count)
+{
+  const crc::catalog::crc_algorithm* algorithm = crc_algorithm_of_id(id);
+
+  return (((algorithm != nullptr) && algorithm->verify(message, count)) ? 1 : 0);
+}
+
+extern "C" crc_context* crc_algorithm_context_create(const crc_algorithm_id id)
+{
+  return ((std::size_t(id) < crc::catalog::crc_algorithm_count) ? crc_context_creators[std::size_t(id)]() : nullptr);
+}
+
+extern "C" void crc_algorithm_multi_checksum(const crc_algorithm_id* ids, const size_t id_count, const uint8_t* message, const size_t count, uint64_t* results)
+{
+  // The raw registers are stored in the results and finalized in place.
+  // Unknown identifiers give a result of zero.
+  for(std::size_t index = 0U; index < id_count; ++index)
+  {
+    const crc::catalog::crc_algorithm* algorithm = crc_algorithm_of_id(ids[index]);
+
+    results[index] = ((algorithm != nullptr) ? algorithm->initial_register : 0U);
+  }
+
+  for(std::size_t offset = 0U; offset < count; offset += crc::catalog::crc_multi_block_size)
+  {
+    const std::size_t block_size = (std::min)(crc::catalog::crc_multi_block_size, std::size_t(count - offset));
+
+    for(std::size_t index = 0U; index < id_count; ++index)
+    {
+      const crc::catalog::crc_algorithm* algorithm = crc_algorithm_of_id(ids[index]);
+
+      if(algorithm != nullptr)
+      {
+        results[index] = algorithm->update(results[index], message + offset, block_size);
+      }
+    }
+  }
+
+  for(std::size_t index = 0U; index < id_count; ++index)
+  {
+    const crc::catalog::crc_algorithm* algorithm = crc_algorithm_of_id(ids[index]);
+
+    results[index] = ((algorithm != nullptr) ? algorithm->finalize(results[index]) : 0U);
+  }
+}
+
+extern "C" uint16_t crc_redis_key_slot(const char* key, const size_t count)
+{
+  return crc::catalog::crc_redis_key_slot(key, count);
+}
+
+extern "C" void crc_redis_key_slots(const char* const* keys, const size_t* counts, const size_t key_count, uint16_t* slots)
+{
+  crc::catalog::crc_redis_key_slots(keys, counts, key_count, slots);
+}
+
+extern "C" size_t crc_stats_snapshot(crc_stats_entry* entries, const size_t capacity)
+{
+  static_assert(CRC_STATS_ENGINE_COUNT   == crc::catalog::crc_stats_engine_count,   "Error: Wrong engine count.");
+  static_assert(CRC_STATS_HISTOGRAM_SIZE == crc::catalog::crc_stats_histogram_size, "Error: Wrong histogram size.");
+
+  // At most crc_stats_max_algorithms algorithms are recorded, so that a
+  // larger capacity needs no more memory. Nothing may throw into C, and
+  // no algorithms are reported if the memory is not available.
+  const std::size_t algorithm_capacity = (std::min)(std::size_t(capacity), crc::catalog::crc_stats_max_algorithms);
+
+  const std::unique_ptr<crc::catalog::crc_stats_algorithm[]>
+    algorithms((algorithm_capacity != 0U) ? new(std::nothrow) crc::catalog::crc_stats_algorithm[algorithm_capacity] : nullptr);
+
+  if((algorithm_capacity != 0U) && (algorithms == nullptr))
+  {
+    return 0U;
+  }
+
+  const std::size_t algorithm_count = crc::catalog::crc_stats_snapshot(algorithms.get(), algorithm_capacity);
+
+  for(std::size_t index = 0U; index < (std::min)(algorithm_count, algorithm_capacity); ++index)
+  {
+    entries[index].name = algorithms[index].name;
+
+    std::copy(std::begin(algorithms[index].calls),             std::end(algorithms[index].calls),             entries[index].calls);
+    std::copy(std::begin(algorithms[index].bytes),             std::end(algorithms[index].bytes),             entries[index].bytes);
+    std::copy(std::begin(algorithms[index].size_histogram),    std::end(algorithms[index].size_histogram),    entries[index].size_histogram);
+    std::copy(std::begin(algorithms[index].latency_histogram), std::end(algorithms[index].latency_histogram), entries[index].latency_histogram);
+  }
+
+  return algorithm_count;
+}
+
+extern "C" const char* crc_stats_engine_name(const unsigned engine)
+{
+  return crc::catalog::crc_stats_engine_name(crc::catalog::crc_stats_engine(engine));
+}
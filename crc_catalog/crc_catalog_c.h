@@ -119,6 +119,418 @@
   uint64_t crc_crc64_xz          (const uint8_t* message, const size_t count);
   uint64_t crc_crc64_jones_redis (const uint8_t* message, const size_t count);
 
+  // Combine the CRCs of two messages A and B into the CRC of A||B, given the length of B in bytes.
+
+  uint8_t  crc_crc03_gsm_combine         (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc03_rohc_combine        (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc04_interlaken_combine  (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc04_itu_combine         (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc05_epc_combine         (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc05_itu_combine         (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc05_usb_combine         (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc06_cdma2000_a_combine  (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc06_cdma2000_b_combine  (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc06_darc_combine        (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc06_gsm_combine         (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc06_itu_combine         (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc07_combine             (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc07_rohc_combine        (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc07_umts_combine        (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc08_combine             (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc08_autosar_combine     (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc08_bluetooth_combine   (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc08_cdma2000_combine    (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc08_darc_combine        (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc08_dvb_s2_combine      (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc08_ebu_combine         (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc08_gsm_a_combine       (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc08_gsm_b_combine       (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc08_i_code_combine      (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc08_itu_combine         (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc08_lte_combine         (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc08_maxim_combine       (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc08_opensafety_combine  (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc08_rohc_combine        (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc08_sae_j1850_combine   (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint8_t  crc_crc08_wcdma_combine       (const uint8_t  crc_a, const uint8_t  crc_b, const uint64_t length_b);
+  uint16_t crc_crc10_combine             (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc10_cdma2000_combine    (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc10_gsm_combine         (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc11_combine             (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc11_umts_combine        (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc12_cdma2000_combine    (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc12_dect_combine        (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc12_gsm_combine         (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc12_umts_combine        (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc13_bbc_combine         (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc14_darc_combine        (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc14_gsm_combine         (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc15_combine             (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc15_mpt1327_combine     (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_arc_combine         (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_aug_ccitt_combine   (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_buypass_combine     (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_ccitt_false_combine (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_cdma2000_combine    (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_cms_combine         (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_dds_110_combine     (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_dect_r_combine      (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_dect_x_combine      (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_dnp_combine         (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_en_13757_combine    (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_genibus_combine     (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_gsm_combine         (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_lj1200_combine      (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_maxim_combine       (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_mcrf4xx_combine     (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_opensafety_a_combine(const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_opensafety_b_combine(const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_profibus_combine    (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_riello_combine      (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_t10_dif_combine     (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_teledisk_combine    (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_tms37157_combine    (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_usb_combine         (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_a_combine           (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_kermit_combine      (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_modbus_combine      (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_x_25_combine        (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint16_t crc_crc16_xmodem_combine      (const uint16_t crc_a, const uint16_t crc_b, const uint64_t length_b);
+  uint32_t crc_crc17_can_fd_combine      (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b);
+  uint32_t crc_crc21_can_fd_combine      (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b);
+  uint32_t crc_crc24_combine             (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b);
+  uint32_t crc_crc24_ble_combine         (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b);
+  uint32_t crc_crc24_flexray_a_combine   (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b);
+  uint32_t crc_crc24_flexray_b_combine   (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b);
+  uint32_t crc_crc24_interlaken_combine  (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b);
+  uint32_t crc_crc24_lte_a_combine       (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b);
+  uint32_t crc_crc24_lte_b_combine       (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b);
+  uint32_t crc_crc30_cdma_combine        (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b);
+  uint32_t crc_crc31_philips_combine     (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b);
+  uint32_t crc_crc32_combine             (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b);
+  uint32_t crc_crc32_autosar_combine     (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b);
+  uint32_t crc_crc32_bzip2_combine       (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b);
+  uint32_t crc_crc32_c_combine           (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b);
+  uint32_t crc_crc32_d_combine           (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b);
+  uint32_t crc_crc32_mpeg_2_combine      (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b);
+  uint32_t crc_crc32_posix_combine       (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b);
+  uint32_t crc_crc32_q_combine           (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b);
+  uint32_t crc_crc32_jamcrc_combine      (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b);
+  uint32_t crc_crc32_xfer_combine        (const uint32_t crc_a, const uint32_t crc_b, const uint64_t length_b);
+  uint64_t crc_crc40_gsm_combine         (const uint64_t crc_a, const uint64_t crc_b, const uint64_t length_b);
+  uint64_t crc_crc64_combine             (const uint64_t crc_a, const uint64_t crc_b, const uint64_t length_b);
+  uint64_t crc_crc64_go_iso_combine      (const uint64_t crc_a, const uint64_t crc_b, const uint64_t length_b);
+  uint64_t crc_crc64_we_combine          (const uint64_t crc_a, const uint64_t crc_b, const uint64_t length_b);
+  uint64_t crc_crc64_xz_combine          (const uint64_t crc_a, const uint64_t crc_b, const uint64_t length_b);
+  uint64_t crc_crc64_jones_redis_combine (const uint64_t crc_a, const uint64_t crc_b, const uint64_t length_b);
+
+  // Incremental CRC computation with an opaque context. A context is
+  // created for a specific algorithm, for instance with
+  // crc_crc32_context_create(), fed with any number of message pieces
+  // using crc_context_update() and released with crc_context_destroy().
+  // crc_context_finalize() returns the CRC of the pieces so far (in the
+  // low bits of the result) without modifying the context, and
+  // crc_context_reset() restarts the computation of a new message.
+  // The create functions return NULL if memory can not be allocated.
+  // crc_context_update_segments() passes a message held as a chain of
+  // segments (scatter-gather input, as with iovec) without copying it.
+
+  typedef struct crc_context crc_context;
+
+  typedef struct crc_segment
+  {
+    const uint8_t* data;
+    size_t         count;
+  }
+  crc_segment;
+
+  crc_context* crc_crc03_gsm_context_create         (void);
+  crc_context* crc_crc03_rohc_context_create        (void);
+  crc_context* crc_crc04_interlaken_context_create  (void);
+  crc_context* crc_crc04_itu_context_create         (void);
+  crc_context* crc_crc05_epc_context_create         (void);
+  crc_context* crc_crc05_itu_context_create         (void);
+  crc_context* crc_crc05_usb_context_create         (void);
+  crc_context* crc_crc06_cdma2000_a_context_create  (void);
+  crc_context* crc_crc06_cdma2000_b_context_create  (void);
+  crc_context* crc_crc06_darc_context_create        (void);
+  crc_context* crc_crc06_gsm_context_create         (void);
+  crc_context* crc_crc06_itu_context_create         (void);
+  crc_context* crc_crc07_context_create             (void);
+  crc_context* crc_crc07_rohc_context_create        (void);
+  crc_context* crc_crc07_umts_context_create        (void);
+  crc_context* crc_crc08_context_create             (void);
+  crc_context* crc_crc08_autosar_context_create     (void);
+  crc_context* crc_crc08_bluetooth_context_create   (void);
+  crc_context* crc_crc08_cdma2000_context_create    (void);
+  crc_context* crc_crc08_darc_context_create        (void);
+  crc_context* crc_crc08_dvb_s2_context_create      (void);
+  crc_context* crc_crc08_ebu_context_create         (void);
+  crc_context* crc_crc08_gsm_a_context_create       (void);
+  crc_context* crc_crc08_gsm_b_context_create       (void);
+  crc_context* crc_crc08_i_code_context_create      (void);
+  crc_context* crc_crc08_itu_context_create         (void);
+  crc_context* crc_crc08_lte_context_create         (void);
+  crc_context* crc_crc08_maxim_context_create       (void);
+  crc_context* crc_crc08_opensafety_context_create  (void);
+  crc_context* crc_crc08_rohc_context_create        (void);
+  crc_context* crc_crc08_sae_j1850_context_create   (void);
+  crc_context* crc_crc08_wcdma_context_create       (void);
+  crc_context* crc_crc10_context_create             (void);
+  crc_context* crc_crc10_cdma2000_context_create    (void);
+  crc_context* crc_crc10_gsm_context_create         (void);
+  crc_context* crc_crc11_context_create             (void);
+  crc_context* crc_crc11_umts_context_create        (void);
+  crc_context* crc_crc12_cdma2000_context_create    (void);
+  crc_context* crc_crc12_dect_context_create        (void);
+  crc_context* crc_crc12_gsm_context_create         (void);
+  crc_context* crc_crc12_umts_context_create        (void);
+  crc_context* crc_crc13_bbc_context_create         (void);
+  crc_context* crc_crc14_darc_context_create        (void);
+  crc_context* crc_crc14_gsm_context_create         (void);
+  crc_context* crc_crc15_context_create             (void);
+  crc_context* crc_crc15_mpt1327_context_create     (void);
+  crc_context* crc_crc16_arc_context_create         (void);
+  crc_context* crc_crc16_aug_ccitt_context_create   (void);
+  crc_context* crc_crc16_buypass_context_create     (void);
+  crc_context* crc_crc16_ccitt_false_context_create (void);
+  crc_context* crc_crc16_cdma2000_context_create    (void);
+  crc_context* crc_crc16_cms_context_create         (void);
+  crc_context* crc_crc16_dds_110_context_create     (void);
+  crc_context* crc_crc16_dect_r_context_create      (void);
+  crc_context* crc_crc16_dect_x_context_create      (void);
+  crc_context* crc_crc16_dnp_context_create         (void);
+  crc_context* crc_crc16_en_13757_context_create    (void);
+  crc_context* crc_crc16_genibus_context_create     (void);
+  crc_context* crc_crc16_gsm_context_create         (void);
+  crc_context* crc_crc16_lj1200_context_create      (void);
+  crc_context* crc_crc16_maxim_context_create       (void);
+  crc_context* crc_crc16_mcrf4xx_context_create     (void);
+  crc_context* crc_crc16_opensafety_a_context_create(void);
+  crc_context* crc_crc16_opensafety_b_context_create(void);
+  crc_context* crc_crc16_profibus_context_create    (void);
+  crc_context* crc_crc16_riello_context_create      (void);
+  crc_context* crc_crc16_t10_dif_context_create     (void);
+  crc_context* crc_crc16_teledisk_context_create    (void);
+  crc_context* crc_crc16_tms37157_context_create    (void);
+  crc_context* crc_crc16_usb_context_create         (void);
+  crc_context* crc_crc16_a_context_create           (void);
+  crc_context* crc_crc16_kermit_context_create      (void);
+  crc_context* crc_crc16_modbus_context_create      (void);
+  crc_context* crc_crc16_x_25_context_create        (void);
+  crc_context* crc_crc16_xmodem_context_create      (void);
+  crc_context* crc_crc17_can_fd_context_create      (void);
+  crc_context* crc_crc21_can_fd_context_create      (void);
+  crc_context* crc_crc24_context_create             (void);
+  crc_context* crc_crc24_ble_context_create         (void);
+  crc_context* crc_crc24_flexray_a_context_create   (void);
+  crc_context* crc_crc24_flexray_b_context_create   (void);
+  crc_context* crc_crc24_interlaken_context_create  (void);
+  crc_context* crc_crc24_lte_a_context_create       (void);
+  crc_context* crc_crc24_lte_b_context_create       (void);
+  crc_context* crc_crc30_cdma_context_create        (void);
+  crc_context* crc_crc31_philips_context_create     (void);
+  crc_context* crc_crc32_context_create             (void);
+  crc_context* crc_crc32_autosar_context_create     (void);
+  crc_context* crc_crc32_bzip2_context_create       (void);
+  crc_context* crc_crc32_c_context_create           (void);
+  crc_context* crc_crc32_d_context_create           (void);
+  crc_context* crc_crc32_mpeg_2_context_create      (void);
+  crc_context* crc_crc32_posix_context_create       (void);
+  crc_context* crc_crc32_q_context_create           (void);
+  crc_context* crc_crc32_jamcrc_context_create      (void);
+  crc_context* crc_crc32_xfer_context_create        (void);
+  crc_context* crc_crc40_gsm_context_create         (void);
+  crc_context* crc_crc64_context_create             (void);
+  crc_context* crc_crc64_go_iso_context_create      (void);
+  crc_context* crc_crc64_we_context_create          (void);
+  crc_context* crc_crc64_xz_context_create          (void);
+  crc_context* crc_crc64_jones_redis_context_create (void);
+
+  void     crc_context_update         (crc_context* context, const uint8_t* message, const size_t count);
+  void     crc_context_update_segments(crc_context* context, const crc_segment* segments, const size_t segment_count);
+  uint64_t crc_context_finalize       (const crc_context* context);
+  void     crc_context_reset          (crc_context* context);
+  void     crc_context_destroy        (crc_context* context);
+
+  // Runtime selection of the algorithm, for instance from configuration
+  // (see also crc_catalog_registry.h). The identifiers are in the order
+  // of the catalog. crc_algorithm_find() accepts the catalog name (such
+  // as "CRC-16/MODBUS") or the name of the named CRC without its prefix
+  // (such as "crc16_modbus"), ignoring the case, and returns
+  // crc_algorithm_unknown for an unknown name. The other functions
+  // return zero (or NULL) for crc_algorithm_unknown.
+  // crc_algorithm_checksum_bits() takes the length of the message in
+  // bits, see crc_engine::checksum_bits in crc_catalog.h.
+  // crc_algorithm_patch() updates the CRC of a message of length bytes
+  // after count bytes at offset have been changed in place from
+  // old_bytes to new_bytes, see crc_patch in crc_catalog.h.
+
+  typedef enum crc_algorithm_id
+  {
+    crc_algorithm_crc03_gsm,
+    crc_algorithm_crc03_rohc,
+    crc_algorithm_crc04_interlaken,
+    crc_algorithm_crc04_itu,
+    crc_algorithm_crc05_epc,
+    crc_algorithm_crc05_itu,
+    crc_algorithm_crc05_usb,
+    crc_algorithm_crc06_cdma2000_a,
+    crc_algorithm_crc06_cdma2000_b,
+    crc_algorithm_crc06_darc,
+    crc_algorithm_crc06_gsm,
+    crc_algorithm_crc06_itu,
+    crc_algorithm_crc07,
+    crc_algorithm_crc07_rohc,
+    crc_algorithm_crc07_umts,
+    crc_algorithm_crc08,
+    crc_algorithm_crc08_autosar,
+    crc_algorithm_crc08_bluetooth,
+    crc_algorithm_crc08_cdma2000,
+    crc_algorithm_crc08_darc,
+    crc_algorithm_crc08_dvb_s2,
+    crc_algorithm_crc08_ebu,
+    crc_algorithm_crc08_gsm_a,
+    crc_algorithm_crc08_gsm_b,
+    crc_algorithm_crc08_i_code,
+    crc_algorithm_crc08_itu,
+    crc_algorithm_crc08_lte,
+    crc_algorithm_crc08_maxim,
+    crc_algorithm_crc08_opensafety,
+    crc_algorithm_crc08_rohc,
+    crc_algorithm_crc08_sae_j1850,
+    crc_algorithm_crc08_wcdma,
+    crc_algorithm_crc10,
+    crc_algorithm_crc10_cdma2000,
+    crc_algorithm_crc10_gsm,
+    crc_algorithm_crc11,
+    crc_algorithm_crc11_umts,
+    crc_algorithm_crc12_cdma2000,
+    crc_algorithm_crc12_dect,
+    crc_algorithm_crc12_gsm,
+    crc_algorithm_crc12_umts,
+    crc_algorithm_crc13_bbc,
+    crc_algorithm_crc14_darc,
+    crc_algorithm_crc14_gsm,
+    crc_algorithm_crc15,
+    crc_algorithm_crc15_mpt1327,
+    crc_algorithm_crc16_arc,
+    crc_algorithm_crc16_aug_ccitt,
+    crc_algorithm_crc16_buypass,
+    crc_algorithm_crc16_ccitt_false,
+    crc_algorithm_crc16_cdma2000,
+    crc_algorithm_crc16_cms,
+    crc_algorithm_crc16_dds_110,
+    crc_algorithm_crc16_dect_r,
+    crc_algorithm_crc16_dect_x,
+    crc_algorithm_crc16_dnp,
+    crc_algorithm_crc16_en_13757,
+    crc_algorithm_crc16_genibus,
+    crc_algorithm_crc16_gsm,
+    crc_algorithm_crc16_lj1200,
+    crc_algorithm_crc16_maxim,
+    crc_algorithm_crc16_mcrf4xx,
+    crc_algorithm_crc16_opensafety_a,
+    crc_algorithm_crc16_opensafety_b,
+    crc_algorithm_crc16_profibus,
+    crc_algorithm_crc16_riello,
+    crc_algorithm_crc16_t10_dif,
+    crc_algorithm_crc16_teledisk,
+    crc_algorithm_crc16_tms37157,
+    crc_algorithm_crc16_usb,
+    crc_algorithm_crc16_a,
+    crc_algorithm_crc16_kermit,
+    crc_algorithm_crc16_modbus,
+    crc_algorithm_crc16_x_25,
+    crc_algorithm_crc16_xmodem,
+    crc_algorithm_crc17_can_fd,
+    crc_algorithm_crc21_can_fd,
+    crc_algorithm_crc24,
+    crc_algorithm_crc24_ble,
+    crc_algorithm_crc24_flexray_a,
+    crc_algorithm_crc24_flexray_b,
+    crc_algorithm_crc24_interlaken,
+    crc_algorithm_crc24_lte_a,
+    crc_algorithm_crc24_lte_b,
+    crc_algorithm_crc30_cdma,
+    crc_algorithm_crc31_philips,
+    crc_algorithm_crc32,
+    crc_algorithm_crc32_autosar,
+    crc_algorithm_crc32_bzip2,
+    crc_algorithm_crc32_c,
+    crc_algorithm_crc32_d,
+    crc_algorithm_crc32_mpeg_2,
+    crc_algorithm_crc32_posix,
+    crc_algorithm_crc32_q,
+    crc_algorithm_crc32_jamcrc,
+    crc_algorithm_crc32_xfer,
+    crc_algorithm_crc40_gsm,
+    crc_algorithm_crc64,
+    crc_algorithm_crc64_go_iso,
+    crc_algorithm_crc64_we,
+    crc_algorithm_crc64_xz,
+    crc_algorithm_crc64_jones_redis,
+    crc_algorithm_unknown
+  }
+  crc_algorithm_id;
+
+  crc_algorithm_id crc_algorithm_find          (const char* name);
+  const char*      crc_algorithm_name          (const crc_algorithm_id id);
+  unsigned         crc_algorithm_width         (const crc_algorithm_id id);
+  uint64_t         crc_algorithm_check         (const crc_algorithm_id id);
+  uint64_t         crc_algorithm_checksum      (const crc_algorithm_id id, const uint8_t* message, const size_t count);
+  uint64_t         crc_algorithm_gather        (const crc_algorithm_id id, const crc_segment* segments, const size_t segment_count);
+  uint64_t         crc_algorithm_checksum_bits (const crc_algorithm_id id, const uint8_t* message, const size_t bits);
+  uint64_t         crc_algorithm_combine       (const crc_algorithm_id id, const uint64_t crc_a, const uint64_t crc_b, const uint64_t length_b);
+  uint64_t         crc_algorithm_patch         (const crc_algorithm_id id, const uint64_t crc, const uint64_t length, const uint64_t offset, const uint8_t* old_bytes, const uint8_t* new_bytes, const size_t count);
+  crc_context*     crc_algorithm_context_create(const crc_algorithm_id id);
+
+  // Append the CRC of count bytes of the message to the field of
+  // crc_algorithm_field_size() bytes following them, and verify a message
+  // of count bytes including its trailing CRC (giving 1 if it is intact
+  // and 0 otherwise). See crc_append and crc_verify in crc_catalog.h
+  // for the layout of the field.
+  size_t           crc_algorithm_field_size    (const crc_algorithm_id id);
+  uint64_t         crc_algorithm_append        (const crc_algorithm_id id, uint8_t* message, const size_t count);
+  int              crc_algorithm_verify        (const crc_algorithm_id id, const uint8_t* message, const size_t count);
+
+  // Compute the CRCs of several algorithms over the same message in one
+  // pass over memory. The CRC for ids[i] is stored in results[i].
+  void crc_algorithm_multi_checksum(const crc_algorithm_id* ids, const size_t id_count, const uint8_t* message, const size_t count, uint64_t* results);
+
+  // The Redis Cluster slot of a key of count bytes (the CRC-16/XMODEM of
+  // its hash tag modulo 16384, see crc_catalog_redis.h), and the slots of
+  // key_count keys, the slot of keys[i] having counts[i] bytes being
+  // stored in slots[i].
+  uint16_t crc_redis_key_slot (const char* key, const size_t count);
+  void     crc_redis_key_slots(const char* const* keys, const size_t* counts, const size_t key_count, uint16_t* slots);
+
+  // The counters of the computations, available if the library is built
+  // with CRC_CATALOG_ENABLE_STATS (see crc_catalog_stats.h). The engines
+  // are indexed in the order bitwise, nibble, nibble_pair, table, slicing,
+  // clmul and crc32c, and crc_stats_engine_name() gives their names. The
+  // histogram buckets are powers of 4 of the message size in bytes and of
+  // the latency in nanoseconds (of timed calls only). The counts are
+  // estimated from one in CRC_CATALOG_STATS_SAMPLE_PERIOD calls per thread
+  // on average. crc_stats_snapshot() fills up to capacity entries and
+  // returns the number of algorithms used so far (zero without
+  // CRC_CATALOG_ENABLE_STATS).
+  #define CRC_STATS_ENGINE_COUNT    7
+  #define CRC_STATS_HISTOGRAM_SIZE 16
+
+  typedef struct crc_stats_entry
+  {
+    const char* name;
+    uint64_t    calls[CRC_STATS_ENGINE_COUNT];
+    uint64_t    bytes[CRC_STATS_ENGINE_COUNT];
+    uint64_t    size_histogram[CRC_STATS_HISTOGRAM_SIZE];
+    uint64_t    latency_histogram[CRC_STATS_HISTOGRAM_SIZE];
+  }
+  crc_stats_entry;
+
+  size_t      crc_stats_snapshot   (crc_stats_entry* entries, const size_t capacity);
+  const char* crc_stats_engine_name(const unsigned engine);
+
   #if defined(__cplusplus)
   }
   #endif
@@ -0,0 +1,671 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2000 - 2018.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef CRC_CATALOG_FILE_2018_12_29_H_
+  #define CRC_CATALOG_FILE_2018_12_29_H_
+
+  #include <cerrno>
+  #include <condition_variable>
+  #include <cstddef>
+  #include <cstdint>
+  #include <cstdio>
+  #include <cstring>
+  #include <mutex>
+  #include <thread>
+  #include <utility>
+  #include <vector>
+
+  #include <crc_catalog.h>
+  #include <crc_catalog_registry.h>
+
+  #if defined(__unix__) || defined(__APPLE__)
+  #include <sys/stat.h>
+  #include <unistd.h>
+  #define CRC_CATALOG_HAS_FILE_DESCRIPTOR
+  #endif
+
+  // Reads of regular files are issued with io_uring on Linux if the kernel
+  // supports it (with a fallback to a reader thread at runtime otherwise).
+  // Define CRC_CATALOG_DISABLE_IO_URING in order to always use the thread.
+  #if defined(__linux__) && !defined(CRC_CATALOG_DISABLE_IO_URING) && defined(__has_include)
+    #if __has_include(<linux/io_uring.h>)
+    #include <linux/io_uring.h>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #define CRC_CATALOG_HAS_IO_URING
+    #endif
+  #endif
+
+  namespace crc { namespace catalog {
+
+  // Pipelined CRCs of files. The file is read into a ring of aligned
+  // buffers, and each buffer is checksummed as soon as its read has
+  // completed while the reads of the following buffers are in flight,
+  // so the I/O and the computation overlap. All of the given registry
+  // algorithms are computed in the same pass (see crc_multi_update).
+  // This suits files too large to be mapped into memory, and storage
+  // on which reading a mapping page by page is slow.
+
+  // The size of each buffer, the number of buffers in the ring and
+  // the alignment of the buffers (which is suitable for direct I/O).
+  constexpr std::size_t crc_file_buffer_size      = 1024U * 1024U;
+  constexpr std::size_t crc_file_buffer_count     = 4U;
+  constexpr std::size_t crc_file_buffer_alignment = 4096U;
+
+  namespace detail {
+
+  class crc_file_buffers
+  {
+  public:
+    crc_file_buffers(const std::size_t buffer_size, const std::size_t buffer_count)
+      : my_buffer_size (((((buffer_size != 0U) ? buffer_size : crc_file_buffer_size) + crc_file_buffer_alignment) - 1U) & ~(crc_file_buffer_alignment - 1U)),
+        my_buffer_count((buffer_count != 0U) ? buffer_count : crc_file_buffer_count),
+        my_storage     ((my_buffer_size * my_buffer_count) + crc_file_buffer_alignment)
+    {
+      const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(my_storage.data());
+
+      my_first_buffer = my_storage.data() + ((crc_file_buffer_alignment - (address % crc_file_buffer_alignment)) % crc_file_buffer_alignment);
+    }
+
+    std::size_t   buffer_size () const { return my_buffer_size; }
+    std::size_t   buffer_count() const { return my_buffer_count; }
+    std::uint8_t* buffer(const std::size_t index) { return my_first_buffer + (index * my_buffer_size); }
+
+    // Give up the storage without freeing it, for reads into it that may
+    // still be in flight. The buffers must not be used any more.
+    void abandon() { static_cast<void>(new std::vector<std::uint8_t>(std::move(my_storage))); }
+
+  private:
+    const std::size_t         my_buffer_size;
+    const std::size_t         my_buffer_count;
+    std::vector<std::uint8_t> my_storage;
+    std::uint8_t*             my_first_buffer;
+  };
+
+  // The registers of the algorithms and the number of bytes so far.
+  struct crc_file_state
+  {
+    const crc_algorithm* const* algorithms;
+    std::size_t                 algorithm_count;
+    std::uint64_t*              registers;
+    std::uint64_t               size;
+
+    crc_file_state(const crc_algorithm* const* algorithms_, const std::size_t algorithm_count_, std::uint64_t* registers_)
+      : algorithms(algorithms_), algorithm_count(algorithm_count_), registers(registers_), size(0U)
+    {
+      for(std::size_t index = 0U; index < algorithm_count; ++index)
+      {
+        registers[index] = algorithms[index]->initial_register;
+      }
+    }
+
+    void update(const std::uint8_t* data, const std::size_t count)
+    {
+      crc_multi_update(algorithms, algorithm_count, registers, data, count);
+
+      size += count;
+    }
+
+    void finalize(std::uint64_t* file_size)
+    {
+      for(std::size_t index = 0U; index < algorithm_count; ++index)
+      {
+        registers[index] = algorithms[index]->finalize(registers[index]);
+      }
+
+      if(file_size != nullptr)
+      {
+        *file_size = size;
+      }
+    }
+  };
+
+  // The pipeline with a reader thread, which fills the buffers of the
+  // ring in turn while the calling thread checksums the filled ones.
+  template<typename ReadFunction>
+  bool crc_file_pipeline(ReadFunction& read, crc_file_buffers& buffers, crc_file_state& state)
+  {
+    std::vector<std::size_t> lengths(buffers.buffer_count());
+
+    std::mutex              ring_mutex;
+    std::condition_variable ring_condition;
+    std::size_t             filled_count   = 0U;
+    std::size_t             consumed_count = 0U;
+    bool                    reader_is_done = false;
+    int                     read_error     = 0;
+
+    std::thread reader([&]()
+    {
+      for(;;)
+      {
+        std::size_t slot;
+
+        {
+          std::unique_lock<std::mutex> ring_lock(ring_mutex);
+
+          ring_condition.wait(ring_lock, [&]() { return ((filled_count - consumed_count) < buffers.buffer_count()); });
+
+          slot = filled_count % buffers.buffer_count();
+        }
+
+        const std::ptrdiff_t read_count = read(buffers.buffer(slot), buffers.buffer_size());
+
+        const int error = ((read_count < 0) ? ((errno != 0) ? errno : EIO) : 0);
+
+        const std::lock_guard<std::mutex> ring_lock(ring_mutex);
+
+        if(read_count <= 0)
+        {
+          reader_is_done = true;
+          read_error     = error;
+
+          ring_condition.notify_one();
+
+          return;
+        }
+
+        lengths[slot] = std::size_t(read_count);
+
+        ++filled_count;
+
+        ring_condition.notify_one();
+      }
+    });
+
+    for(;;)
+    {
+      std::size_t slot;
+
+      {
+        std::unique_lock<std::mutex> ring_lock(ring_mutex);
+
+        ring_condition.wait(ring_lock, [&]() { return ((consumed_count < filled_count) || reader_is_done); });
+
+        if(consumed_count == filled_count)
+        {
+          break;
+        }
+
+        slot = consumed_count % buffers.buffer_count();
+      }
+
+      state.update(buffers.buffer(slot), lengths[slot]);
+
+      const std::lock_guard<std::mutex> ring_lock(ring_mutex);
+
+      ++consumed_count;
+
+      ring_condition.notify_one();
+    }
+
+    reader.join();
+
+    errno = read_error;
+
+    return (read_error == 0);
+  }
+
+  #if defined(CRC_CATALOG_HAS_IO_URING)
+
+  // A minimal io_uring for reads, using the system calls directly.
+  class crc_io_uring
+  {
+  public:
+    explicit crc_io_uring(const unsigned entry_count)
+      : my_ring_descriptor(-1),
+        my_sq_ring        (MAP_FAILED),
+        my_cq_ring        (MAP_FAILED),
+        my_sqes           (MAP_FAILED),
+        my_sq_ring_size   (0U),
+        my_cq_ring_size   (0U),
+        my_sqes_size      (0U)
+    {
+      io_uring_params parameters;
+
+      std::memset(&parameters, 0, sizeof(parameters));
+
+      my_ring_descriptor = int(::syscall(__NR_io_uring_setup, entry_count, &parameters));
+
+      if(my_ring_descriptor < 0)
+      {
+        return;
+      }
+
+      my_sq_ring_size = parameters.sq_off.array + (parameters.sq_entries * sizeof(unsigned));
+      my_cq_ring_size = parameters.cq_off.cqes  + (parameters.cq_entries * sizeof(io_uring_cqe));
+      my_sqes_size    = parameters.sq_entries * sizeof(io_uring_sqe);
+
+      const bool single_mapping = ((parameters.features & IORING_FEAT_SINGLE_MMAP) != 0U);
+
+      if(single_mapping)
+      {
+        my_sq_ring_size = ((my_sq_ring_size < my_cq_ring_size) ? my_cq_ring_size : my_sq_ring_size);
+      }
+
+      my_sq_ring = ::mmap(nullptr, my_sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, my_ring_descriptor, IORING_OFF_SQ_RING);
+      my_cq_ring = (single_mapping ? my_sq_ring : ::mmap(nullptr, my_cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, my_ring_descriptor, IORING_OFF_CQ_RING));
+      my_sqes    = ::mmap(nullptr, my_sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, my_ring_descriptor, IORING_OFF_SQES);
+
+      if(single_mapping)
+      {
+        my_cq_ring_size = 0U;
+      }
+
+      if((my_sq_ring == MAP_FAILED) || (my_cq_ring == MAP_FAILED) || (my_sqes == MAP_FAILED))
+      {
+        release();
+
+        return;
+      }
+
+      std::uint8_t* sq_ring = static_cast<std::uint8_t*>(my_sq_ring);
+      std::uint8_t* cq_ring = static_cast<std::uint8_t*>(my_cq_ring);
+
+      my_sq_tail  = reinterpret_cast<unsigned*>(sq_ring + parameters.sq_off.tail);
+      my_sq_mask  = *reinterpret_cast<unsigned*>(sq_ring + parameters.sq_off.ring_mask);
+      my_sq_array = reinterpret_cast<unsigned*>(sq_ring + parameters.sq_off.array);
+      my_cq_head  = reinterpret_cast<unsigned*>(cq_ring + parameters.cq_off.head);
+      my_cq_tail  = reinterpret_cast<unsigned*>(cq_ring + parameters.cq_off.tail);
+      my_cq_mask  = *reinterpret_cast<unsigned*>(cq_ring + parameters.cq_off.ring_mask);
+      my_cqes     = reinterpret_cast<io_uring_cqe*>(cq_ring + parameters.cq_off.cqes);
+    }
+
+    ~crc_io_uring() { release(); }
+
+    crc_io_uring(const crc_io_uring&) = delete;
+    crc_io_uring& operator=(const crc_io_uring&) = delete;
+
+    bool is_valid() const { return (my_ring_descriptor >= 0); }
+
+    // Keep the ring (and the reads in flight on it) alive for the rest of
+    // the process, when it can no longer be waited on.
+    void abandon()
+    {
+      my_sqes            = MAP_FAILED;
+      my_cq_ring         = MAP_FAILED;
+      my_sq_ring         = MAP_FAILED;
+      my_ring_descriptor = -1;
+    }
+
+    // Submit a read of count bytes at the given offset of the file.
+    bool submit_read(const int file_descriptor, std::uint8_t* buffer, const unsigned count, const std::uint64_t offset, const std::uint64_t user_data)
+    {
+      const unsigned tail  = *my_sq_tail;
+      const unsigned index = tail & my_sq_mask;
+
+      io_uring_sqe& entry = static_cast<io_uring_sqe*>(my_sqes)[index];
+
+      std::memset(&entry, 0, sizeof(entry));
+
+      entry.opcode    = IORING_OP_READ;
+      entry.fd        = file_descriptor;
+      entry.addr      = std::uint64_t(reinterpret_cast<std::uintptr_t>(buffer));
+      entry.len       = count;
+      entry.off       = offset;
+      entry.user_data = user_data;
+
+      my_sq_array[index] = index;
+
+      __atomic_store_n(my_sq_tail, tail + 1U, __ATOMIC_RELEASE);
+
+      for(;;)
+      {
+        const long submitted = ::syscall(__NR_io_uring_enter, my_ring_descriptor, 1U, 0U, 0U, nullptr, 0U);
+
+        if(submitted >= 0)
+        {
+          return (submitted == 1);
+        }
+
+        if((errno != EINTR) && (errno != EAGAIN))
+        {
+          return false;
+        }
+      }
+    }
+
+    // Wait for the next completion, giving its user data and result.
+    // Interrupted and temporarily failing waits are retried, so that false
+    // means that the ring is unusable.
+    bool wait_completion(std::uint64_t& user_data, int& result)
+    {
+      for(;;)
+      {
+        const unsigned head = *my_cq_head;
+
+        if(head != __atomic_load_n(my_cq_tail, __ATOMIC_ACQUIRE))
+        {
+          const io_uring_cqe& entry = my_cqes[head & my_cq_mask];
+
+          user_data = entry.user_data;
+          result    = entry.res;
+
+          __atomic_store_n(my_cq_head, head + 1U, __ATOMIC_RELEASE);
+
+          return true;
+        }
+
+        if(   (::syscall(__NR_io_uring_enter, my_ring_descriptor, 0U, 1U, IORING_ENTER_GETEVENTS, nullptr, 0U) < 0)
+           && (errno != EINTR)
+           && (errno != EAGAIN)
+           && (errno != EBUSY))
+        {
+          return false;
+        }
+      }
+    }
+
+  private:
+    int           my_ring_descriptor;
+    void*         my_sq_ring;
+    void*         my_cq_ring;
+    void*         my_sqes;
+    std::size_t   my_sq_ring_size;
+    std::size_t   my_cq_ring_size;
+    std::size_t   my_sqes_size;
+    unsigned*     my_sq_tail;
+    unsigned      my_sq_mask;
+    unsigned*     my_sq_array;
+    unsigned*     my_cq_head;
+    unsigned*     my_cq_tail;
+    unsigned      my_cq_mask;
+    io_uring_cqe* my_cqes;
+
+    void release()
+    {
+      if(my_sqes != MAP_FAILED)                                    { ::munmap(my_sqes, my_sqes_size); }
+      if((my_cq_ring != MAP_FAILED) && (my_cq_ring != my_sq_ring)) { ::munmap(my_cq_ring, my_cq_ring_size); }
+      if(my_sq_ring != MAP_FAILED)                                 { ::munmap(my_sq_ring, my_sq_ring_size); }
+      if(my_ring_descriptor >= 0)                                  { ::close(my_ring_descriptor); }
+
+      my_sqes            = MAP_FAILED;
+      my_cq_ring         = MAP_FAILED;
+      my_sq_ring         = MAP_FAILED;
+      my_ring_descriptor = -1;
+    }
+  };
+
+  enum class crc_io_uring_status { complete, failed, unsupported };
+
+  // The pipeline with io_uring: a read is kept in flight for each buffer
+  // of the ring, and the buffers are checksummed in the order of the file.
+  // A short read is continued with a read of the rest of its buffer, and
+  // the file ends with a read giving no data. The status unsupported means
+  // that the kernel lacks the read operation and no data was consumed.
+  inline crc_io_uring_status crc_file_pipeline_io_uring(const int file_descriptor, crc_file_buffers& buffers, crc_file_state& state)
+  {
+    const std::size_t buffer_count = buffers.buffer_count();
+    const unsigned    buffer_size  = unsigned(buffers.buffer_size());
+
+    crc_io_uring ring(static_cast<unsigned>(buffer_count));
+
+    if(ring.is_valid() == false)
+    {
+      return crc_io_uring_status::unsupported;
+    }
+
+    struct slot_type
+    {
+      std::uint64_t offset;
+      unsigned      filled_count;
+      bool          is_pending;
+      int           result;
+    };
+
+    std::vector<slot_type> slots(buffer_count);
+
+    std::uint64_t next_offset   = 0U;
+    std::size_t   pending_count = 0U;
+    int           error         = 0;
+    bool          is_supported  = true;
+
+    const auto submit = [&](const std::size_t slot) -> bool
+    {
+      slot_type& next_slot = slots[slot];
+
+      const bool is_submitted = ring.submit_read(file_descriptor,
+                                                 buffers.buffer(slot) + next_slot.filled_count,
+                                                 buffer_size - next_slot.filled_count,
+                                                 next_slot.offset + next_slot.filled_count,
+                                                 std::uint64_t(slot));
+
+      next_slot.is_pending = is_submitted;
+
+      pending_count += (is_submitted ? 1U : 0U);
+
+      return is_submitted;
+    };
+
+    for(std::size_t slot = 0U; (slot < buffer_count) && (error == 0); ++slot)
+    {
+      slots[slot] = slot_type { next_offset, 0U, false, 0 };
+
+      next_offset += buffer_size;
+
+      error = (submit(slot) ? 0 : errno);
+    }
+
+    for(std::size_t slot = 0U; (error == 0); )
+    {
+      if(slots[slot].is_pending)
+      {
+        std::uint64_t user_data;
+        int           result;
+
+        if(ring.wait_completion(user_data, result) == false)
+        {
+          error = errno;
+
+          break;
+        }
+
+        slots[std::size_t(user_data)].is_pending = false;
+        slots[std::size_t(user_data)].result     = result;
+
+        --pending_count;
+
+        continue;
+      }
+
+      const int result = slots[slot].result;
+
+      if(result < 0)
+      {
+        // Without IORING_OP_READ (before Linux 5.6) the reads fail with EINVAL.
+        is_supported = ((result != -EINVAL) || (state.size != 0U));
+
+        error = -result;
+
+        break;
+      }
+
+      if(result == 0)
+      {
+        break;
+      }
+
+      state.update(buffers.buffer(slot) + slots[slot].filled_count, std::size_t(result));
+
+      slots[slot].filled_count += unsigned(result);
+
+      if(slots[slot].filled_count == buffer_size)
+      {
+        slots[slot] = slot_type { next_offset, 0U, false, 0 };
+
+        next_offset += buffer_size;
+      }
+
+      error = (submit(slot) ? 0 : errno);
+
+      if(slots[slot].filled_count == 0U)
+      {
+        slot = (slot + 1U) % buffer_count;
+      }
+    }
+
+    // The buffers must not be released while reads into them are in flight.
+    // If the ring can no longer be waited on, the ring and the buffers are
+    // left to the kernel instead.
+    bool is_abandoned = false;
+
+    while(pending_count != 0U)
+    {
+      std::uint64_t user_data;
+      int           result;
+
+      if(ring.wait_completion(user_data, result) == false)
+      {
+        error = ((error != 0) ? error : errno);
+
+        ring.abandon();
+        buffers.abandon();
+
+        is_abandoned = true;
+
+        break;
+      }
+
+      --pending_count;
+    }
+
+    errno = error;
+
+    return (((is_supported == false) && (is_abandoned == false)) ? crc_io_uring_status::unsupported
+                                                                 : ((error == 0) ? crc_io_uring_status::complete : crc_io_uring_status::failed));
+  }
+
+  #endif // CRC_CATALOG_HAS_IO_URING
+
+  } // namespace crc::catalog::detail
+
+  // Compute the CRCs of the data delivered by a read function. The read
+  // function is called in a reader thread as read(buffer, size) and gives
+  // the number of bytes read (up to size), 0 at the end of the data or a
+  // negative value with errno set on error. It must not throw. The CRC of
+  // algorithms[i] is stored in results[i], and the number of bytes in
+  // *size if size is not null. Returns false and sets errno on error.
+
+  template<typename ReadFunction>
+  bool crc_file_checksum(ReadFunction                read,
+                         const crc_algorithm* const* algorithms,
+                         const std::size_t           algorithm_count,
+                         std::uint64_t*              results,
+                         std::uint64_t*              size         = nullptr,
+                         const std::size_t           buffer_size  = crc_file_buffer_size,
+                         const std::size_t           buffer_count = crc_file_buffer_count)
+  {
+    detail::crc_file_buffers buffers(buffer_size, buffer_count);
+    detail::crc_file_state   state(algorithms, algorithm_count, results);
+
+    const bool result_is_ok = detail::crc_file_pipeline(read, buffers, state);
+
+    state.finalize(size);
+
+    return result_is_ok;
+  }
+
+  // The CRCs of a stream, from its current position to its end.
+
+  inline bool crc_file_checksum(std::FILE*                  stream,
+                                const crc_algorithm* const* algorithms,
+                                const std::size_t           algorithm_count,
+                                std::uint64_t*              results,
+                                std::uint64_t*              size         = nullptr,
+                                const std::size_t           buffer_size  = crc_file_buffer_size,
+                                const std::size_t           buffer_count = crc_file_buffer_count)
+  {
+    return crc_file_checksum([stream](std::uint8_t* buffer, const std::size_t count) -> std::ptrdiff_t
+                             {
+                               const std::size_t read_count = std::fread(buffer, 1U, count, stream);
+
+                               return (((read_count == 0U) && (std::ferror(stream) != 0)) ? -1 : std::ptrdiff_t(read_count));
+                             },
+                             algorithms,
+                             algorithm_count,
+                             results,
+                             size,
+                             buffer_size,
+                             buffer_count);
+  }
+
+  #if defined(CRC_CATALOG_HAS_FILE_DESCRIPTOR)
+
+  // The CRCs of an open file, from its start for regular files (which
+  // are read with io_uring where available) and otherwise (for instance
+  // for a pipe) from its current position to its end.
+
+  inline bool crc_file_checksum(const int                   file_descriptor,
+                                const crc_algorithm* const* algorithms,
+                                const std::size_t           algorithm_count,
+                                std::uint64_t*              results,
+                                std::uint64_t*              size         = nullptr,
+                                const std::size_t           buffer_size  = crc_file_buffer_size,
+                                const std::size_t           buffer_count = crc_file_buffer_count)
+  {
+    detail::crc_file_buffers buffers(buffer_size, buffer_count);
+    detail::crc_file_state   state(algorithms, algorithm_count, results);
+
+    struct stat file_status;
+
+    const bool file_is_regular = ((::fstat(file_descriptor, &file_status) == 0) && S_ISREG(file_status.st_mode));
+
+    bool result_is_ok = false;
+    bool is_read      = false;
+
+    #if defined(CRC_CATALOG_HAS_IO_URING)
+    if(file_is_regular && (buffers.buffer_size() <= 0x40000000U))
+    {
+      const detail::crc_io_uring_status status = detail::crc_file_pipeline_io_uring(file_descriptor, buffers, state);
+
+      result_is_ok = (status == detail::crc_io_uring_status::complete);
+      is_read      = (status != detail::crc_io_uring_status::unsupported);
+    }
+    #endif
+
+    if(is_read == false)
+    {
+      std::uint64_t offset = 0U;
+
+      // Regular files are read from their start with pread, the others with read.
+      auto read = [file_descriptor, file_is_regular, &offset](std::uint8_t* buffer, const std::size_t count) -> std::ptrdiff_t
+      {
+        for(;;)
+        {
+          const ssize_t read_count = (file_is_regular ? ::pread(file_descriptor, buffer, count, off_t(offset))
+                                                      : ::read (file_descriptor, buffer, count));
+
+          if(read_count >= 0)
+          {
+            offset += std::uint64_t(read_count);
+
+            return std::ptrdiff_t(read_count);
+          }
+
+          if(errno != EINTR)
+          {
+            return -1;
+          }
+        }
+      };
+
+      result_is_ok = detail::crc_file_pipeline(read, buffers, state);
+    }
+
+    const int error = errno;
+
+    state.finalize(size);
+
+    errno = (result_is_ok ? 0 : error);
+
+    return result_is_ok;
+  }
+
+  #endif // CRC_CATALOG_HAS_FILE_DESCRIPTOR
+
+  } } // namespace crc::catalog
+
+#endif // CRC_CATALOG_FILE_2018_12_29_H_
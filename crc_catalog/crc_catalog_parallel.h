@@ -0,0 +1,171 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2000 - 2018.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef CRC_CATALOG_PARALLEL_2018_12_08_H_
+  #define CRC_CATALOG_PARALLEL_2018_12_08_H_
+
+  #include <algorithm>
+  #include <condition_variable>
+  #include <cstddef>
+  #include <cstdint>
+  #include <exception>
+  #include <mutex>
+  #include <thread>
+  #include <vector>
+
+  #include <crc_catalog.h>
+
+  namespace crc { namespace catalog {
+
+  // Parallel CRC over large buffers. The buffer is split into contiguous
+  // chunks whose CRCs are computed concurrently and then merged with
+  // crc_combine(), so the result is identical to the serial CRC.
+
+  // Chunks are not made smaller than this, since the cost of
+  // dispatching a task and combining would outweigh the gain.
+  constexpr std::size_t crc_parallel_minimum_chunk_size = 65536U;
+
+  // Compute the CRC with chunk_count tasks handed to the executor.
+  // The executor is any callable taking a task (a callable without
+  // parameters) which it runs, either synchronously or in some thread,
+  // for instance by posting it to a thread pool. The call returns
+  // when all of the tasks have completed.
+
+  template<typename Params,
+           typename ExecutorType>
+  typename Params::value_type crc_parallel(const std::uint8_t* message,
+                                           const std::size_t   count,
+                                           ExecutorType&&      executor,
+                                           const std::size_t   chunk_count)
+  {
+    using value_type = typename Params::value_type;
+
+    const std::size_t used_chunk_count =
+      (std::max)(std::size_t(1U), (std::min)(chunk_count, std::size_t(count / crc_parallel_minimum_chunk_size)));
+
+    if(used_chunk_count == 1U)
+    {
+      return crc_engine<Params>::checksum(message, count);
+    }
+
+    const std::size_t chunk_size = ((count + used_chunk_count) - 1U) / used_chunk_count;
+
+    std::vector<value_type> partial_crcs(used_chunk_count);
+
+    std::mutex              completion_mutex;
+    std::condition_variable completion_condition;
+    std::size_t             pending_count = used_chunk_count;
+
+    std::exception_ptr submit_exception;
+
+    for(std::size_t chunk = 0U; chunk < used_chunk_count; ++chunk)
+    {
+      const std::size_t offset = chunk * chunk_size;
+      const std::size_t length = (std::min)(chunk_size, std::size_t(count - offset));
+
+      try
+      {
+        executor([&partial_crcs, &completion_mutex, &completion_condition, &pending_count, message, chunk, offset, length]()
+        {
+          partial_crcs[chunk] = crc_engine<Params>::checksum(message + offset, length);
+
+          // Notify while holding the lock, so that the waiting caller
+          // can not return (and destroy the condition) in between.
+          std::lock_guard<std::mutex> completion_lock(completion_mutex);
+
+          if(--pending_count == 0U)
+          {
+            completion_condition.notify_one();
+          }
+        });
+      }
+      catch(...)
+      {
+        // Wait for the tasks already submitted before reporting the error.
+        submit_exception = std::current_exception();
+
+        std::lock_guard<std::mutex> completion_lock(completion_mutex);
+
+        pending_count -= (used_chunk_count - chunk);
+
+        break;
+      }
+    }
+
+    {
+      std::unique_lock<std::mutex> completion_lock(completion_mutex);
+
+      completion_condition.wait(completion_lock, [&pending_count]() { return (pending_count == 0U); });
+    }
+
+    if(submit_exception)
+    {
+      std::rethrow_exception(submit_exception);
+    }
+
+    value_type crc = partial_crcs[0U];
+
+    for(std::size_t chunk = 1U; chunk < used_chunk_count; ++chunk)
+    {
+      const std::size_t length = (std::min)(chunk_size, std::size_t(count - (chunk * chunk_size)));
+
+      crc = crc_combine<Params>(crc, partial_crcs[chunk], length);
+    }
+
+    return crc;
+  }
+
+  // Compute the CRC using thread_count threads, one chunk each.
+  // A thread count of zero selects the number of hardware threads.
+
+  template<typename Params>
+  typename Params::value_type crc_parallel(const std::uint8_t* message,
+                                           const std::size_t   count,
+                                           const unsigned      thread_count = 0U)
+  {
+    const std::size_t used_thread_count =
+      ((thread_count != 0U) ? thread_count : (std::max)(1U, std::thread::hardware_concurrency()));
+
+    std::vector<std::thread> threads;
+
+    struct thread_joiner
+    {
+      std::vector<std::thread>& my_threads;
+
+      ~thread_joiner()
+      {
+        for(std::thread& next_thread : my_threads)
+        {
+          next_thread.join();
+        }
+      }
+    };
+
+    const thread_joiner joiner { threads };
+
+    // The calling thread computes the last of the chunks itself.
+    std::size_t submitted_count = 0U;
+
+    return crc_parallel<Params>(message,
+                                count,
+                                [&threads, &submitted_count, used_thread_count](auto task)
+                                {
+                                  if(++submitted_count < used_thread_count)
+                                  {
+                                    threads.emplace_back(std::move(task));
+                                  }
+                                  else
+                                  {
+                                    task();
+                                  }
+                                },
+                                used_thread_count);
+  }
+
+  } } // namespace crc::catalog
+
+#endif // CRC_CATALOG_PARALLEL_2018_12_08_H_
@@ -0,0 +1,86 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2000 - 2018.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef CRC_CATALOG_REDIS_2018_12_30_H_
+  #define CRC_CATALOG_REDIS_2018_12_30_H_
+
+  #include <cstddef>
+  #include <cstdint>
+  #include <cstring>
+
+  #include <crc_catalog.h>
+
+  namespace crc { namespace catalog {
+
+  // Redis Cluster key slots. The slot of a key is the CRC-16/XMODEM of its
+  // hash tag modulo 16384. The hash tag is the part of the key between the
+  // first '{' and the first '}' following it, provided that this part is
+  // not empty. Otherwise the whole key is hashed. The braces are found with
+  // memchr, and the hashed part then takes one pass of the default engine
+  // (carry-less multiplication for 16 bytes or more, slicing below).
+  //
+  // The payloads of DUMP and RESTORE (and RDB files) end with their
+  // CRC-64/REDIS, which crc_verify<crc_crc64_jones_redis_params>()
+  // checks in one pass.
+
+  constexpr std::size_t crc_redis_slot_count = 16384U;
+
+  // The part of the key that is hashed, given by its offset and size.
+  inline void crc_redis_hash_tag(const char* key, const std::size_t count, std::size_t& tag_offset, std::size_t& tag_count)
+  {
+    tag_offset = 0U;
+    tag_count  = count;
+
+    const char* tag_begin = ((count != 0U) ? static_cast<const char*>(std::memchr(key, '{', count)) : nullptr);
+
+    if(tag_begin != nullptr)
+    {
+      ++tag_begin;
+
+      const std::size_t rest_count = std::size_t(count - std::size_t(tag_begin - key));
+
+      const char* tag_end = ((rest_count != 0U) ? static_cast<const char*>(std::memchr(tag_begin, '}', rest_count)) : nullptr);
+
+      if((tag_end != nullptr) && (tag_end != tag_begin))
+      {
+        tag_offset = std::size_t(tag_begin - key);
+        tag_count  = std::size_t(tag_end - tag_begin);
+      }
+    }
+  }
+
+  inline std::uint16_t crc_redis_key_slot(const char* key, const std::size_t count)
+  {
+    std::size_t tag_offset;
+    std::size_t tag_count;
+
+    crc_redis_hash_tag(key, count, tag_offset, tag_count);
+
+    const std::uint16_t crc =
+      crc_engine<crc_crc16_xmodem_params>::checksum(reinterpret_cast<const std::uint8_t*>(key + tag_offset), tag_count);
+
+    return std::uint16_t(crc & std::uint16_t(crc_redis_slot_count - 1U));
+  }
+
+  // The slots of many keys in one call (for instance of the keys of MGET
+  // or MSET, or of a pipeline). The slot of the key at keys[i] having
+  // counts[i] bytes is stored in slots[i].
+
+  inline void crc_redis_key_slots(const char* const* keys,
+                                  const std::size_t* counts,
+                                  const std::size_t  key_count,
+                                  std::uint16_t*     slots)
+  {
+    for(std::size_t index = 0U; index < key_count; ++index)
+    {
+      slots[index] = crc_redis_key_slot(keys[index], counts[index]);
+    }
+  }
+
+  } } // namespace crc::catalog
+
+#endif // CRC_CATALOG_REDIS_2018_12_30_H_
@@ -0,0 +1,470 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2000 - 2018.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef CRC_CATALOG_REGISTRY_2018_12_15_H_
+  #define CRC_CATALOG_REGISTRY_2018_12_15_H_
+
+  #include <cstddef>
+  #include <cstdint>
+
+  #include <crc_catalog.h>
+
+  namespace crc { namespace catalog {
+
+  // Runtime selection of a catalog algorithm, for instance from configuration.
+  // Each algorithm of the catalog has a registry entry holding its parameters
+  // and function pointers to its kernel, which are the same engines as the
+  // ones of the named CRCs. Their lookup tables and folding constants are
+  // constant data generated at compile time, and the selection of the
+  // hardware-accelerated path is made on first use and cached in
+  // thread-safe local statics. So the registry itself is constant and
+  // needs no initialization or locking. Values are held in the low bits
+  // of std::uint64_t.
+
+  // The identifiers of the algorithms, in the order of the catalog.
+  enum class crc_algorithm_id : unsigned
+  {
+    crc03_gsm,
+    crc03_rohc,
+    crc04_interlaken,
+    crc04_itu,
+    crc05_epc,
+    crc05_itu,
+    crc05_usb,
+    crc06_cdma2000_a,
+    crc06_cdma2000_b,
+    crc06_darc,
+    crc06_gsm,
+    crc06_itu,
+    crc07,
+    crc07_rohc,
+    crc07_umts,
+    crc08,
+    crc08_autosar,
+    crc08_bluetooth,
+    crc08_cdma2000,
+    crc08_darc,
+    crc08_dvb_s2,
+    crc08_ebu,
+    crc08_gsm_a,
+    crc08_gsm_b,
+    crc08_i_code,
+    crc08_itu,
+    crc08_lte,
+    crc08_maxim,
+    crc08_opensafety,
+    crc08_rohc,
+    crc08_sae_j1850,
+    crc08_wcdma,
+    crc10,
+    crc10_cdma2000,
+    crc10_gsm,
+    crc11,
+    crc11_umts,
+    crc12_cdma2000,
+    crc12_dect,
+    crc12_gsm,
+    crc12_umts,
+    crc13_bbc,
+    crc14_darc,
+    crc14_gsm,
+    crc15,
+    crc15_mpt1327,
+    crc16_arc,
+    crc16_aug_ccitt,
+    crc16_buypass,
+    crc16_ccitt_false,
+    crc16_cdma2000,
+    crc16_cms,
+    crc16_dds_110,
+    crc16_dect_r,
+    crc16_dect_x,
+    crc16_dnp,
+    crc16_en_13757,
+    crc16_genibus,
+    crc16_gsm,
+    crc16_lj1200,
+    crc16_maxim,
+    crc16_mcrf4xx,
+    crc16_opensafety_a,
+    crc16_opensafety_b,
+    crc16_profibus,
+    crc16_riello,
+    crc16_t10_dif,
+    crc16_teledisk,
+    crc16_tms37157,
+    crc16_usb,
+    crc16_a,
+    crc16_kermit,
+    crc16_modbus,
+    crc16_x_25,
+    crc16_xmodem,
+    crc17_can_fd,
+    crc21_can_fd,
+    crc24,
+    crc24_ble,
+    crc24_flexray_a,
+    crc24_flexray_b,
+    crc24_interlaken,
+    crc24_lte_a,
+    crc24_lte_b,
+    crc30_cdma,
+    crc31_philips,
+    crc32,
+    crc32_autosar,
+    crc32_bzip2,
+    crc32_c,
+    crc32_d,
+    crc32_mpeg_2,
+    crc32_posix,
+    crc32_q,
+    crc32_jamcrc,
+    crc32_xfer,
+    crc40_gsm,
+    crc64,
+    crc64_go_iso,
+    crc64_we,
+    crc64_xz,
+    crc64_jones_redis
+  };
+
+  constexpr std::size_t crc_algorithm_count = 102U;
+
+  struct crc_algorithm
+  {
+    crc_algorithm_id id;
+    const char*      name;       // The catalog name, such as "CRC-32".
+    const char*      identifier; // The name of the named CRC without its prefix, such as "crc32".
+    std::size_t      number_of_bits;
+    std::uint64_t    polynomial;
+    std::uint64_t    initial_value;
+    std::uint64_t    final_xor_value;
+    bool             reflect_in;
+    bool             reflect_out;
+    std::uint64_t    check;
+    std::uint64_t    residue;
+
+    // The CRC of a whole message, of a message held in segments (see
+    // crc_gather) and of a message of any number of bits (see
+    // crc_engine::checksum_bits).
+    std::uint64_t (*checksum)     (const std::uint8_t* message, const std::size_t count);
+    std::uint64_t (*gather)       (const crc_segment* segments, const std::size_t segment_count);
+    std::uint64_t (*checksum_bits)(const std::uint8_t* message, const std::size_t bits);
+
+    // The raw register interface for messages arriving in pieces: start
+    // with initial_register, update it with each piece and finalize it.
+    std::uint64_t initial_register;
+    std::uint64_t (*update)  (const std::uint64_t crc_register, const std::uint8_t* message, const std::size_t count);
+    std::uint64_t (*finalize)(const std::uint64_t crc_register);
+
+    // The CRC of the concatenation A||B, see crc_combine.
+    std::uint64_t (*combine)(const std::uint64_t crc_a, const std::uint64_t crc_b, const std::uint64_t length_b);
+
+    // The CRC of a message after bytes have been changed in place, see crc_patch.
+    std::uint64_t (*patch)(const std::uint64_t crc, const std::uint64_t length, const std::uint64_t offset, const std::uint8_t* old_bytes, const std::uint8_t* new_bytes, const std::size_t count);
+
+    // Append the CRC to a message and verify a message with a trailing
+    // CRC of field_size bytes, see crc_append and crc_verify.
+    std::size_t   field_size;
+    std::uint64_t (*append)(std::uint8_t* message, const std::size_t count);
+    bool          (*verify)(const std::uint8_t* message, const std::size_t count);
+  };
+
+  namespace detail {
+
+  template<typename Params>
+  std::uint64_t crc_algorithm_checksum(const std::uint8_t* message, const std::size_t count)
+  {
+    return std::uint64_t(crc_engine<Params>::checksum(message, count));
+  }
+
+  template<typename Params>
+  std::uint64_t crc_algorithm_gather(const crc_segment* segments, const std::size_t segment_count)
+  {
+    return std::uint64_t(crc_gather<Params>(segments, segment_count));
+  }
+
+  template<typename Params>
+  std::uint64_t crc_algorithm_checksum_bits(const std::uint8_t* message, const std::size_t bits)
+  {
+    return std::uint64_t(crc_engine<Params>::checksum_bits(message, bits));
+  }
+
+  template<typename Params>
+  std::uint64_t crc_algorithm_update(const std::uint64_t crc_register, const std::uint8_t* message, const std::size_t count)
+  {
+    using engine_type = typename crc_default_policy::template engine_type<Params>;
+
+    return std::uint64_t(crc_engine_update<Params, engine_type>(typename Params::value_type(crc_register), message, count));
+  }
+
+  template<typename Params>
+  std::uint64_t crc_algorithm_finalize(const std::uint64_t crc_register)
+  {
+    return std::uint64_t(crc_register_finalize<Params::number_of_bits, Params::reflect_in>(typename Params::value_type(crc_register),
+                                                                                          Params::final_xor_value,
+                                                                                          Params::reflect_out));
+  }
+
+  template<typename Params>
+  std::uint64_t crc_algorithm_combine(const std::uint64_t crc_a, const std::uint64_t crc_b, const std::uint64_t length_b)
+  {
+    using value_type = typename Params::value_type;
+
+    return std::uint64_t(crc_combine<Params>(value_type(crc_a), value_type(crc_b), length_b));
+  }
+
+  template<typename Params>
+  std::uint64_t crc_algorithm_patch(const std::uint64_t crc, const std::uint64_t length, const std::uint64_t offset, const std::uint8_t* old_bytes, const std::uint8_t* new_bytes, const std::size_t count)
+  {
+    return std::uint64_t(crc_patch<Params>(typename Params::value_type(crc), length, offset, old_bytes, new_bytes, count));
+  }
+
+  template<typename Params>
+  std::uint64_t crc_algorithm_append(std::uint8_t* message, const std::size_t count)
+  {
+    return std::uint64_t(crc_append<Params>(message, count));
+  }
+
+  template<typename Params>
+  bool crc_algorithm_verify(const std::uint8_t* message, const std::size_t count)
+  {
+    return crc::catalog::crc_verify<Params>(message, count);
+  }
+
+  template<typename Params>
+  constexpr crc_algorithm crc_algorithm_make(const crc_algorithm_id id, const char* identifier)
+  {
+    return
+    {
+      id,
+      Params::name(),
+      identifier,
+      Params::number_of_bits,
+      std::uint64_t(Params::polynomial),
+      std::uint64_t(Params::initial_value),
+      std::uint64_t(Params::final_xor_value),
+      Params::reflect_in,
+      Params::reflect_out,
+      std::uint64_t(Params::check),
+      std::uint64_t(Params::residue),
+      crc_algorithm_checksum<Params>,
+      crc_algorithm_gather<Params>,
+      crc_algorithm_checksum_bits<Params>,
+      std::uint64_t(crc_register_initialize<Params::number_of_bits, Params::reflect_in>(Params::initial_value)),
+      crc_algorithm_update<Params>,
+      crc_algorithm_finalize<Params>,
+      crc_algorithm_combine<Params>,
+      crc_algorithm_patch<Params>,
+      crc_field_size<Params>(),
+      crc_algorithm_append<Params>,
+      crc_algorithm_verify<Params>
+    };
+  }
+
+  // Compare ASCII names ignoring the case.
+  inline bool crc_algorithm_name_equals(const char* name, const char* other_name)
+  {
+    const auto lower = [](const char c) -> char { return (((c >= 'A') && (c <= 'Z')) ? char(c + ('a' - 'A')) : c); };
+
+    while((*name != '\0') && (lower(*name) == lower(*other_name)))
+    {
+      ++name;
+      ++other_name;
+    }
+
+    return (*name == *other_name);
+  }
+
+  } // namespace crc::catalog::detail
+
+  // All of the registry entries, indexed by the identifier.
+  inline const crc_algorithm* crc_algorithms()
+  {
+    static constexpr crc_algorithm algorithms[crc_algorithm_count] =
+    {
+      detail::crc_algorithm_make<crc_crc03_gsm_params         >(crc_algorithm_id::crc03_gsm,          "crc03_gsm"         ),
+      detail::crc_algorithm_make<crc_crc03_rohc_params        >(crc_algorithm_id::crc03_rohc,         "crc03_rohc"        ),
+      detail::crc_algorithm_make<crc_crc04_interlaken_params  >(crc_algorithm_id::crc04_interlaken,   "crc04_interlaken"  ),
+      detail::crc_algorithm_make<crc_crc04_itu_params         >(crc_algorithm_id::crc04_itu,          "crc04_itu"         ),
+      detail::crc_algorithm_make<crc_crc05_epc_params         >(crc_algorithm_id::crc05_epc,          "crc05_epc"         ),
+      detail::crc_algorithm_make<crc_crc05_itu_params         >(crc_algorithm_id::crc05_itu,          "crc05_itu"         ),
+      detail::crc_algorithm_make<crc_crc05_usb_params         >(crc_algorithm_id::crc05_usb,          "crc05_usb"         ),
+      detail::crc_algorithm_make<crc_crc06_cdma2000_a_params  >(crc_algorithm_id::crc06_cdma2000_a,   "crc06_cdma2000_a"  ),
+      detail::crc_algorithm_make<crc_crc06_cdma2000_b_params  >(crc_algorithm_id::crc06_cdma2000_b,   "crc06_cdma2000_b"  ),
+      detail::crc_algorithm_make<crc_crc06_darc_params        >(crc_algorithm_id::crc06_darc,         "crc06_darc"        ),
+      detail::crc_algorithm_make<crc_crc06_gsm_params         >(crc_algorithm_id::crc06_gsm,          "crc06_gsm"         ),
+      detail::crc_algorithm_make<crc_crc06_itu_params         >(crc_algorithm_id::crc06_itu,          "crc06_itu"         ),
+      detail::crc_algorithm_make<crc_crc07_params             >(crc_algorithm_id::crc07,              "crc07"             ),
+      detail::crc_algorithm_make<crc_crc07_rohc_params        >(crc_algorithm_id::crc07_rohc,         "crc07_rohc"        ),
+      detail::crc_algorithm_make<crc_crc07_umts_params        >(crc_algorithm_id::crc07_umts,         "crc07_umts"        ),
+      detail::crc_algorithm_make<crc_crc08_params             >(crc_algorithm_id::crc08,              "crc08"             ),
+      detail::crc_algorithm_make<crc_crc08_autosar_params     >(crc_algorithm_id::crc08_autosar,      "crc08_autosar"     ),
+      detail::crc_algorithm_make<crc_crc08_bluetooth_params   >(crc_algorithm_id::crc08_bluetooth,    "crc08_bluetooth"   ),
+      detail::crc_algorithm_make<crc_crc08_cdma2000_params    >(crc_algorithm_id::crc08_cdma2000,     "crc08_cdma2000"    ),
+      detail::crc_algorithm_make<crc_crc08_darc_params        >(crc_algorithm_id::crc08_darc,         "crc08_darc"        ),
+      detail::crc_algorithm_make<crc_crc08_dvb_s2_params      >(crc_algorithm_id::crc08_dvb_s2,       "crc08_dvb_s2"      ),
+      detail::crc_algorithm_make<crc_crc08_ebu_params         >(crc_algorithm_id::crc08_ebu,          "crc08_ebu"         ),
+      detail::crc_algorithm_make<crc_crc08_gsm_a_params       >(crc_algorithm_id::crc08_gsm_a,        "crc08_gsm_a"       ),
+      detail::crc_algorithm_make<crc_crc08_gsm_b_params       >(crc_algorithm_id::crc08_gsm_b,        "crc08_gsm_b"       ),
+      detail::crc_algorithm_make<crc_crc08_i_code_params      >(crc_algorithm_id::crc08_i_code,       "crc08_i_code"      ),
+      detail::crc_algorithm_make<crc_crc08_itu_params         >(crc_algorithm_id::crc08_itu,          "crc08_itu"         ),
+      detail::crc_algorithm_make<crc_crc08_lte_params         >(crc_algorithm_id::crc08_lte,          "crc08_lte"         ),
+      detail::crc_algorithm_make<crc_crc08_maxim_params       >(crc_algorithm_id::crc08_maxim,        "crc08_maxim"       ),
+      detail::crc_algorithm_make<crc_crc08_opensafety_params  >(crc_algorithm_id::crc08_opensafety,   "crc08_opensafety"  ),
+      detail::crc_algorithm_make<crc_crc08_rohc_params        >(crc_algorithm_id::crc08_rohc,         "crc08_rohc"        ),
+      detail::crc_algorithm_make<crc_crc08_sae_j1850_params   >(crc_algorithm_id::crc08_sae_j1850,    "crc08_sae_j1850"   ),
+      detail::crc_algorithm_make<crc_crc08_wcdma_params       >(crc_algorithm_id::crc08_wcdma,        "crc08_wcdma"       ),
+      detail::crc_algorithm_make<crc_crc10_params             >(crc_algorithm_id::crc10,              "crc10"             ),
+      detail::crc_algorithm_make<crc_crc10_cdma2000_params    >(crc_algorithm_id::crc10_cdma2000,     "crc10_cdma2000"    ),
+      detail::crc_algorithm_make<crc_crc10_gsm_params         >(crc_algorithm_id::crc10_gsm,          "crc10_gsm"         ),
+      detail::crc_algorithm_make<crc_crc11_params             >(crc_algorithm_id::crc11,              "crc11"             ),
+      detail::crc_algorithm_make<crc_crc11_umts_params        >(crc_algorithm_id::crc11_umts,         "crc11_umts"        ),
+      detail::crc_algorithm_make<crc_crc12_cdma2000_params    >(crc_algorithm_id::crc12_cdma2000,     "crc12_cdma2000"    ),
+      detail::crc_algorithm_make<crc_crc12_dect_params        >(crc_algorithm_id::crc12_dect,         "crc12_dect"        ),
+      detail::crc_algorithm_make<crc_crc12_gsm_params         >(crc_algorithm_id::crc12_gsm,          "crc12_gsm"         ),
+      detail::crc_algorithm_make<crc_crc12_umts_params        >(crc_algorithm_id::crc12_umts,         "crc12_umts"        ),
+      detail::crc_algorithm_make<crc_crc13_bbc_params         >(crc_algorithm_id::crc13_bbc,          "crc13_bbc"         ),
+      detail::crc_algorithm_make<crc_crc14_darc_params        >(crc_algorithm_id::crc14_darc,         "crc14_darc"        ),
+      detail::crc_algorithm_make<crc_crc14_gsm_params         >(crc_algorithm_id::crc14_gsm,          "crc14_gsm"         ),
+      detail::crc_algorithm_make<crc_crc15_params             >(crc_algorithm_id::crc15,              "crc15"             ),
+      detail::crc_algorithm_make<crc_crc15_mpt1327_params     >(crc_algorithm_id::crc15_mpt1327,      "crc15_mpt1327"     ),
+      detail::crc_algorithm_make<crc_crc16_arc_params         >(crc_algorithm_id::crc16_arc,          "crc16_arc"         ),
+      detail::crc_algorithm_make<crc_crc16_aug_ccitt_params   >(crc_algorithm_id::crc16_aug_ccitt,    "crc16_aug_ccitt"   ),
+      detail::crc_algorithm_make<crc_crc16_buypass_params     >(crc_algorithm_id::crc16_buypass,      "crc16_buypass"     ),
+      detail::crc_algorithm_make<crc_crc16_ccitt_false_params >(crc_algorithm_id::crc16_ccitt_false,  "crc16_ccitt_false" ),
+      detail::crc_algorithm_make<crc_crc16_cdma2000_params    >(crc_algorithm_id::crc16_cdma2000,     "crc16_cdma2000"    ),
+      detail::crc_algorithm_make<crc_crc16_cms_params         >(crc_algorithm_id::crc16_cms,          "crc16_cms"         ),
+      detail::crc_algorithm_make<crc_crc16_dds_110_params     >(crc_algorithm_id::crc16_dds_110,      "crc16_dds_110"     ),
+      detail::crc_algorithm_make<crc_crc16_dect_r_params      >(crc_algorithm_id::crc16_dect_r,       "crc16_dect_r"      ),
+      detail::crc_algorithm_make<crc_crc16_dect_x_params      >(crc_algorithm_id::crc16_dect_x,       "crc16_dect_x"      ),
+      detail::crc_algorithm_make<crc_crc16_dnp_params         >(crc_algorithm_id::crc16_dnp,          "crc16_dnp"         ),
+      detail::crc_algorithm_make<crc_crc16_en_13757_params    >(crc_algorithm_id::crc16_en_13757,     "crc16_en_13757"    ),
+      detail::crc_algorithm_make<crc_crc16_genibus_params     >(crc_algorithm_id::crc16_genibus,      "crc16_genibus"     ),
+      detail::crc_algorithm_make<crc_crc16_gsm_params         >(crc_algorithm_id::crc16_gsm,          "crc16_gsm"         ),
+      detail::crc_algorithm_make<crc_crc16_lj1200_params      >(crc_algorithm_id::crc16_lj1200,       "crc16_lj1200"      ),
+      detail::crc_algorithm_make<crc_crc16_maxim_params       >(crc_algorithm_id::crc16_maxim,        "crc16_maxim"       ),
+      detail::crc_algorithm_make<crc_crc16_mcrf4xx_params     >(crc_algorithm_id::crc16_mcrf4xx,      "crc16_mcrf4xx"     ),
+      detail::crc_algorithm_make<crc_crc16_opensafety_a_params>(crc_algorithm_id::crc16_opensafety_a, "crc16_opensafety_a"),
+      detail::crc_algorithm_make<crc_crc16_opensafety_b_params>(crc_algorithm_id::crc16_opensafety_b, "crc16_opensafety_b"),
+      detail::crc_algorithm_make<crc_crc16_profibus_params    >(crc_algorithm_id::crc16_profibus,     "crc16_profibus"    ),
+      detail::crc_algorithm_make<crc_crc16_riello_params      >(crc_algorithm_id::crc16_riello,       "crc16_riello"      ),
+      detail::crc_algorithm_make<crc_crc16_t10_dif_params     >(crc_algorithm_id::crc16_t10_dif,      "crc16_t10_dif"     ),
+      detail::crc_algorithm_make<crc_crc16_teledisk_params    >(crc_algorithm_id::crc16_teledisk,     "crc16_teledisk"    ),
+      detail::crc_algorithm_make<crc_crc16_tms37157_params    >(crc_algorithm_id::crc16_tms37157,     "crc16_tms37157"    ),
+      detail::crc_algorithm_make<crc_crc16_usb_params         >(crc_algorithm_id::crc16_usb,          "crc16_usb"         ),
+      detail::crc_algorithm_make<crc_crc16_a_params           >(crc_algorithm_id::crc16_a,            "crc16_a"           ),
+      detail::crc_algorithm_make<crc_crc16_kermit_params      >(crc_algorithm_id::crc16_kermit,       "crc16_kermit"      ),
+      detail::crc_algorithm_make<crc_crc16_modbus_params      >(crc_algorithm_id::crc16_modbus,       "crc16_modbus"      ),
+      detail::crc_algorithm_make<crc_crc16_x_25_params        >(crc_algorithm_id::crc16_x_25,         "crc16_x_25"        ),
+      detail::crc_algorithm_make<crc_crc16_xmodem_params      >(crc_algorithm_id::crc16_xmodem,       "crc16_xmodem"      ),
+      detail::crc_algorithm_make<crc_crc17_can_fd_params      >(crc_algorithm_id::crc17_can_fd,       "crc17_can_fd"      ),
+      detail::crc_algorithm_make<crc_crc21_can_fd_params      >(crc_algorithm_id::crc21_can_fd,       "crc21_can_fd"      ),
+      detail::crc_algorithm_make<crc_crc24_params             >(crc_algorithm_id::crc24,              "crc24"             ),
+      detail::crc_algorithm_make<crc_crc24_ble_params         >(crc_algorithm_id::crc24_ble,          "crc24_ble"         ),
+      detail::crc_algorithm_make<crc_crc24_flexray_a_params   >(crc_algorithm_id::crc24_flexray_a,    "crc24_flexray_a"   ),
+      detail::crc_algorithm_make<crc_crc24_flexray_b_params   >(crc_algorithm_id::crc24_flexray_b,    "crc24_flexray_b"   ),
+      detail::crc_algorithm_make<crc_crc24_interlaken_params  >(crc_algorithm_id::crc24_interlaken,   "crc24_interlaken"  ),
+      detail::crc_algorithm_make<crc_crc24_lte_a_params       >(crc_algorithm_id::crc24_lte_a,        "crc24_lte_a"       ),
+      detail::crc_algorithm_make<crc_crc24_lte_b_params       >(crc_algorithm_id::crc24_lte_b,        "crc24_lte_b"       ),
+      detail::crc_algorithm_make<crc_crc30_cdma_params        >(crc_algorithm_id::crc30_cdma,         "crc30_cdma"        ),
+      detail::crc_algorithm_make<crc_crc31_philips_params     >(crc_algorithm_id::crc31_philips,      "crc31_philips"     ),
+      detail::crc_algorithm_make<crc_crc32_params             >(crc_algorithm_id::crc32,              "crc32"             ),
+      detail::crc_algorithm_make<crc_crc32_autosar_params     >(crc_algorithm_id::crc32_autosar,      "crc32_autosar"     ),
+      detail::crc_algorithm_make<crc_crc32_bzip2_params       >(crc_algorithm_id::crc32_bzip2,        "crc32_bzip2"       ),
+      detail::crc_algorithm_make<crc_crc32_c_params           >(crc_algorithm_id::crc32_c,            "crc32_c"           ),
+      detail::crc_algorithm_make<crc_crc32_d_params           >(crc_algorithm_id::crc32_d,            "crc32_d"           ),
+      detail::crc_algorithm_make<crc_crc32_mpeg_2_params      >(crc_algorithm_id::crc32_mpeg_2,       "crc32_mpeg_2"      ),
+      detail::crc_algorithm_make<crc_crc32_posix_params       >(crc_algorithm_id::crc32_posix,        "crc32_posix"       ),
+      detail::crc_algorithm_make<crc_crc32_q_params           >(crc_algorithm_id::crc32_q,            "crc32_q"           ),
+      detail::crc_algorithm_make<crc_crc32_jamcrc_params      >(crc_algorithm_id::crc32_jamcrc,       "crc32_jamcrc"      ),
+      detail::crc_algorithm_make<crc_crc32_xfer_params        >(crc_algorithm_id::crc32_xfer,         "crc32_xfer"        ),
+      detail::crc_algorithm_make<crc_crc40_gsm_params         >(crc_algorithm_id::crc40_gsm,          "crc40_gsm"         ),
+      detail::crc_algorithm_make<crc_crc64_params             >(crc_algorithm_id::crc64,              "crc64"             ),
+      detail::crc_algorithm_make<crc_crc64_go_iso_params      >(crc_algorithm_id::crc64_go_iso,       "crc64_go_iso"      ),
+      detail::crc_algorithm_make<crc_crc64_we_params          >(crc_algorithm_id::crc64_we,           "crc64_we"          ),
+      detail::crc_algorithm_make<crc_crc64_xz_params          >(crc_algorithm_id::crc64_xz,           "crc64_xz"          ),
+      detail::crc_algorithm_make<crc_crc64_jones_redis_params >(crc_algorithm_id::crc64_jones_redis,  "crc64_jones_redis" )
+    };
+
+    return algorithms;
+  }
+
+  // Look up an algorithm by its identifier. This is a simple array access.
+  inline const crc_algorithm& crc_find_algorithm(const crc_algorithm_id id)
+  {
+    return crc_algorithms()[static_cast<std::size_t>(id)];
+  }
+
+  // Look up an algorithm by its catalog name (such as "CRC-32" or
+  // "CRC-16/MODBUS") or by its identifier (such as "crc32" or
+  // "crc16_modbus"), ignoring the case. This returns nullptr
+  // for an unknown name.
+  inline const crc_algorithm* crc_find_algorithm(const char* name)
+  {
+    if(name != nullptr)
+    {
+      for(std::size_t index = 0U; index < crc_algorithm_count; ++index)
+      {
+        const crc_algorithm& algorithm = crc_algorithms()[index];
+
+        if(   detail::crc_algorithm_name_equals(name, algorithm.name)
+           || detail::crc_algorithm_name_equals(name, algorithm.identifier))
+        {
+          return &algorithm;
+        }
+      }
+    }
+
+    return nullptr;
+  }
+
+  // Compute the CRCs of several algorithms over the same message in one
+  // pass over memory, in blocks of crc_multi_block_size bytes (see crc_multi).
+  // The registers are raw registers as for crc_algorithm::update, starting
+  // from the initial registers of the algorithms.
+  inline void crc_multi_update(const crc_algorithm* const* algorithms,
+                               const std::size_t           algorithm_count,
+                               std::uint64_t*              registers,
+                               const std::uint8_t*         message,
+                               const std::size_t           count)
+  {
+    for(std::size_t offset = 0U; offset < count; offset += crc_multi_block_size)
+    {
+      const std::size_t block_size = (((count - offset) < crc_multi_block_size) ? (count - offset) : crc_multi_block_size);
+
+      for(std::size_t index = 0U; index < algorithm_count; ++index)
+      {
+        registers[index] = algorithms[index]->update(registers[index], message + offset, block_size);
+      }
+    }
+  }
+
+  // The CRC of the message for algorithms[i] is stored in results[i].
+  inline void crc_multi_checksum(const crc_algorithm* const* algorithms,
+                                 const std::size_t           algorithm_count,
+                                 const std::uint8_t*         message,
+                                 const std::size_t           count,
+                                 std::uint64_t*              results)
+  {
+    // The raw registers are stored in the results and finalized in place.
+    for(std::size_t index = 0U; index < algorithm_count; ++index)
+    {
+      results[index] = algorithms[index]->initial_register;
+    }
+
+    crc_multi_update(algorithms, algorithm_count, results, message, count);
+
+    for(std::size_t index = 0U; index < algorithm_count; ++index)
+    {
+      results[index] = algorithms[index]->finalize(results[index]);
+    }
+  }
+
+  } } // namespace crc::catalog
+
+#endif // CRC_CATALOG_REGISTRY_2018_12_15_H_
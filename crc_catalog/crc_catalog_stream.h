@@ -0,0 +1,344 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2000 - 2018.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef CRC_CATALOG_STREAM_2018_12_31_H_
+  #define CRC_CATALOG_STREAM_2018_12_31_H_
+
+  #include <cstddef>
+  #include <cstdint>
+  #include <cstring>
+  #include <istream>
+  #include <ostream>
+  #include <streambuf>
+  #include <vector>
+
+  #include <crc_catalog.h>
+
+  namespace crc { namespace catalog {
+
+  // Stream buffers computing the CRC of the characters passing through
+  // them, for instance of the serialized form of objects written to a
+  // std::ostream or read from a std::istream, without a copy of the data.
+  // crc_ostreambuf forwards the characters written to it to a destination
+  // stream buffer, and crc_istreambuf reads the characters from a source
+  // stream buffer. Both keep the characters in a buffer of their own and
+  // update the CRC once for the whole buffer when it is written out or
+  // refilled, so that the engine processes blocks rather than single
+  // characters. Writes and reads larger than the buffer go directly to
+  // the destination or come directly from the source. checksum() gives the
+  // CRC of all characters written or extracted so far at any time,
+  // including the ones still held in the buffer. crc_ostream and
+  // crc_istream are streams using these stream buffers.
+
+  constexpr std::size_t crc_stream_buffer_size = 8192U;
+
+  template<typename Params,
+           typename EnginePolicy = crc_default_policy>
+  class crc_ostreambuf : public std::streambuf
+  {
+  public:
+    using value_type = typename Params::value_type;
+
+    explicit crc_ostreambuf(std::streambuf* destination, const std::size_t buffer_size = crc_stream_buffer_size)
+      : my_destination(destination),
+        my_buffer     ((buffer_size != 0U) ? buffer_size : crc_stream_buffer_size),
+        my_size       (0U)
+    {
+      setp(my_buffer.data(), my_buffer.data() + my_buffer.size());
+    }
+
+    ~crc_ostreambuf() override { static_cast<void>(write_buffer()); }
+
+    crc_ostreambuf(const crc_ostreambuf&) = delete;
+    crc_ostreambuf& operator=(const crc_ostreambuf&) = delete;
+
+    // The CRC and the number of the characters written so far.
+    value_type checksum() const
+    {
+      crc_engine<Params, EnginePolicy> engine(my_engine);
+
+      engine.update(reinterpret_cast<const std::uint8_t*>(pbase()), std::size_t(pptr() - pbase()));
+
+      return engine.finalize();
+    }
+
+    std::uint64_t size() const { return my_size + std::uint64_t(pptr() - pbase()); }
+
+    // Start a new CRC with the next character written.
+    void reset()
+    {
+      static_cast<void>(write_buffer());
+
+      my_engine.reset();
+
+      my_size = 0U;
+    }
+
+  protected:
+    int_type overflow(int_type character) override
+    {
+      if(write_buffer() == false)
+      {
+        return traits_type::eof();
+      }
+
+      if(traits_type::eq_int_type(character, traits_type::eof()))
+      {
+        return traits_type::not_eof(character);
+      }
+
+      *pptr() = traits_type::to_char_type(character);
+
+      pbump(1);
+
+      return character;
+    }
+
+    std::streamsize xsputn(const char* characters, std::streamsize count) override
+    {
+      if(count < std::streamsize(epptr() - pptr()))
+      {
+        std::memcpy(pptr(), characters, std::size_t(count));
+
+        pbump(int(count));
+
+        return count;
+      }
+
+      if(write_buffer() == false)
+      {
+        return 0;
+      }
+
+      if(count < std::streamsize(my_buffer.size()))
+      {
+        std::memcpy(pptr(), characters, std::size_t(count));
+
+        pbump(int(count));
+
+        return count;
+      }
+
+      // Write the characters directly, without passing them through the buffer.
+      return write(characters, count);
+    }
+
+    int sync() override
+    {
+      return ((write_buffer() && (my_destination->pubsync() == 0)) ? 0 : -1);
+    }
+
+  private:
+    std::streambuf*                  my_destination;
+    std::vector<char>                my_buffer;
+    crc_engine<Params, EnginePolicy> my_engine;
+    std::uint64_t                    my_size;
+
+    // Write to the destination and update the CRC with the characters written.
+    std::streamsize write(const char* characters, const std::streamsize count)
+    {
+      const std::streamsize written_count = my_destination->sputn(characters, count);
+
+      my_engine.update(reinterpret_cast<const std::uint8_t*>(characters), std::size_t(written_count));
+
+      my_size += std::uint64_t(written_count);
+
+      return written_count;
+    }
+
+    bool write_buffer()
+    {
+      const std::streamsize count = std::streamsize(pptr() - pbase());
+
+      const bool result_is_ok = ((count == 0) || (write(pbase(), count) == count));
+
+      setp(my_buffer.data(), my_buffer.data() + my_buffer.size());
+
+      return result_is_ok;
+    }
+  };
+
+  template<typename Params,
+           typename EnginePolicy = crc_default_policy>
+  class crc_istreambuf : public std::streambuf
+  {
+  public:
+    using value_type = typename Params::value_type;
+
+    explicit crc_istreambuf(std::streambuf* source, const std::size_t buffer_size = crc_stream_buffer_size)
+      : my_source(source),
+        my_buffer((buffer_size != 0U) ? buffer_size : crc_stream_buffer_size),
+        my_size  (0U)
+    {
+      setg(my_buffer.data(), my_buffer.data(), my_buffer.data());
+    }
+
+    crc_istreambuf(const crc_istreambuf&) = delete;
+    crc_istreambuf& operator=(const crc_istreambuf&) = delete;
+
+    // The CRC and the number of the characters extracted so far. Characters
+    // read ahead from the source but not yet extracted are not included.
+    value_type checksum() const
+    {
+      crc_engine<Params, EnginePolicy> engine(my_engine);
+
+      engine.update(reinterpret_cast<const std::uint8_t*>(eback()), std::size_t(gptr() - eback()));
+
+      return engine.finalize();
+    }
+
+    std::uint64_t size() const { return my_size + std::uint64_t(gptr() - eback()); }
+
+    // Start a new CRC with the next character extracted.
+    void reset()
+    {
+      consume_buffer();
+
+      my_engine.reset();
+
+      my_size = 0U;
+    }
+
+  protected:
+    int_type underflow() override
+    {
+      if(gptr() == egptr())
+      {
+        consume_buffer();
+
+        // Take what the source has available (at least one character),
+        // so that reading from an interactive source does not block.
+        std::streamsize read_count = 0;
+
+        if(traits_type::eq_int_type(my_source->sgetc(), traits_type::eof()) == false)
+        {
+          const std::streamsize available_count = my_source->in_avail();
+
+          const std::streamsize request_count =
+            ((available_count < 1) ? 1 : ((available_count < std::streamsize(my_buffer.size())) ? available_count : std::streamsize(my_buffer.size())));
+
+          read_count = my_source->sgetn(my_buffer.data(), request_count);
+        }
+
+        setg(my_buffer.data(), my_buffer.data(), my_buffer.data() + ((read_count > 0) ? read_count : 0));
+      }
+
+      return ((gptr() == egptr()) ? traits_type::eof() : traits_type::to_int_type(*gptr()));
+    }
+
+    std::streamsize xsgetn(char* characters, std::streamsize count) override
+    {
+      std::streamsize read_count = 0;
+
+      while(read_count < count)
+      {
+        const std::streamsize buffered_count = std::streamsize(egptr() - gptr());
+
+        if(buffered_count > 0)
+        {
+          const std::streamsize copy_count = (((count - read_count) < buffered_count) ? (count - read_count) : buffered_count);
+
+          std::memcpy(characters + read_count, gptr(), std::size_t(copy_count));
+
+          gbump(int(copy_count));
+
+          read_count += copy_count;
+        }
+        else if((count - read_count) >= std::streamsize(my_buffer.size()))
+        {
+          // Read the rest directly, without passing it through the buffer.
+          consume_buffer();
+
+          const std::streamsize direct_count = my_source->sgetn(characters + read_count, count - read_count);
+
+          if(direct_count <= 0)
+          {
+            break;
+          }
+
+          my_engine.update(reinterpret_cast<const std::uint8_t*>(characters + read_count), std::size_t(direct_count));
+
+          my_size += std::uint64_t(direct_count);
+
+          read_count += direct_count;
+        }
+        else if(traits_type::eq_int_type(underflow(), traits_type::eof()))
+        {
+          break;
+        }
+      }
+
+      return read_count;
+    }
+
+  private:
+    std::streambuf*                  my_source;
+    std::vector<char>                my_buffer;
+    crc_engine<Params, EnginePolicy> my_engine;
+    std::uint64_t                    my_size;
+
+    // Update the CRC with the extracted characters of the buffer and
+    // drop them. Characters not yet extracted are kept.
+    void consume_buffer()
+    {
+      const std::size_t count = std::size_t(gptr() - eback());
+
+      my_engine.update(reinterpret_cast<const std::uint8_t*>(eback()), count);
+
+      my_size += count;
+
+      setg(gptr(), gptr(), egptr());
+    }
+  };
+
+  template<typename Params,
+           typename EnginePolicy = crc_default_policy>
+  class crc_ostream : public std::ostream
+  {
+  public:
+    using value_type = typename Params::value_type;
+
+    explicit crc_ostream(std::ostream& destination, const std::size_t buffer_size = crc_stream_buffer_size)
+      : std::ostream(nullptr),
+        my_streambuf(destination.rdbuf(), buffer_size)
+    {
+      rdbuf(&my_streambuf);
+    }
+
+    value_type    checksum() const { return my_streambuf.checksum(); }
+    std::uint64_t size    () const { return my_streambuf.size(); }
+    void          reset   ()       { my_streambuf.reset(); }
+
+  private:
+    crc_ostreambuf<Params, EnginePolicy> my_streambuf;
+  };
+
+  template<typename Params,
+           typename EnginePolicy = crc_default_policy>
+  class crc_istream : public std::istream
+  {
+  public:
+    using value_type = typename Params::value_type;
+
+    explicit crc_istream(std::istream& source, const std::size_t buffer_size = crc_stream_buffer_size)
+      : std::istream(nullptr),
+        my_streambuf(source.rdbuf(), buffer_size)
+    {
+      rdbuf(&my_streambuf);
+    }
+
+    value_type    checksum() const { return my_streambuf.checksum(); }
+    std::uint64_t size    () const { return my_streambuf.size(); }
+    void          reset   ()       { my_streambuf.reset(); }
+
+  private:
+    crc_istreambuf<Params, EnginePolicy> my_streambuf;
+  };
+
+  } } // namespace crc::catalog
+
+#endif // CRC_CATALOG_STREAM_2018_12_31_H_
@@ -0,0 +1,392 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2000 - 2018.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// crcsum: compute catalog CRCs of files, similar to cksum and sha256sum.
+//
+// Usage: crcsum [options] [FILE...]
+//   -a, --algorithm=NAME[,NAME...] catalog names or identifiers (default: CRC-32)
+//   -t, --threads=N                threads used for large files (default: hardware threads)
+//   -f, --format=gnu|bsd|cksum     gnu:   "<crc in hex>  <file>" (default)
+//                                  bsd:   "<algorithm> (<file>) = <crc in hex>"
+//                                  cksum: "<crc in decimal> <size> <file>"
+//   -l, --list                     list the algorithms of the catalog
+//       --no-mmap                  read regular files instead of mapping them
+//
+// With no FILE, or when FILE is -, standard input is read. Regular files
+// are memory-mapped where the platform supports it, and large ones are
+// split into chunks whose CRCs are computed by several threads and then
+// combined. Pipes, other files and files that can not be mapped are read
+// through a ring of buffers, computing the CRC of each buffer while the
+// next ones are being read (see crc_catalog_file.h). With several
+// algorithms, the data is passed over once (see crc_multi_update).
+// The cksum format only mimics the layout of cksum: the CRC is the one of
+// the selected algorithm, without the length appended by POSIX cksum.
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define CRC_SUM_HAS_MMAP
+#endif
+
+#include <crc_catalog.h>
+#include <crc_catalog_file.h>
+#include <crc_catalog_registry.h>
+
+namespace
+{
+  using crc_sum_algorithms = std::vector<const crc::catalog::crc_algorithm*>;
+
+  enum class crc_sum_format { gnu, bsd, cksum };
+
+  struct crc_sum_options
+  {
+    crc_sum_algorithms       algorithms;
+    unsigned                 thread_count = 0U;
+    crc_sum_format           format       = crc_sum_format::gnu;
+    bool                     map_files    = true;
+    std::vector<std::string> files;
+  };
+
+  // Files are not split into chunks smaller than this.
+  constexpr std::size_t crc_sum_minimum_chunk_size = 4U * 1024U * 1024U;
+
+  std::vector<std::uint64_t> crc_sum_initial_registers(const crc_sum_algorithms& algorithms)
+  {
+    std::vector<std::uint64_t> registers;
+
+    for(const crc::catalog::crc_algorithm* algorithm : algorithms)
+    {
+      registers.push_back(algorithm->initial_register);
+    }
+
+    return registers;
+  }
+
+  // All of the algorithms in one pass over the data.
+  void crc_sum_update(const crc_sum_algorithms& algorithms, std::vector<std::uint64_t>& registers, const std::uint8_t* data, const std::size_t size)
+  {
+    crc::catalog::crc_multi_update(algorithms.data(), algorithms.size(), registers.data(), data, size);
+  }
+
+  std::vector<std::uint64_t> crc_sum_finalize(const crc_sum_algorithms& algorithms, const std::vector<std::uint64_t>& registers)
+  {
+    std::vector<std::uint64_t> crcs;
+
+    for(std::size_t index = 0U; index < algorithms.size(); ++index)
+    {
+      crcs.push_back(algorithms[index]->finalize(registers[index]));
+    }
+
+    return crcs;
+  }
+
+  // The CRCs of a buffer in memory, using up to thread_count threads.
+  std::vector<std::uint64_t> crc_sum_buffer(const crc_sum_algorithms& algorithms, const std::uint8_t* data, const std::size_t size, const unsigned thread_count)
+  {
+    const std::size_t chunk_count = (std::max)(std::size_t(1U), (std::min)(std::size_t(thread_count), std::size_t(size / crc_sum_minimum_chunk_size)));
+
+    const std::size_t chunk_size = ((size + chunk_count) - 1U) / chunk_count;
+
+    std::vector<std::vector<std::uint64_t>> chunk_crcs(chunk_count);
+
+    const auto crc_sum_chunk =
+      [&algorithms, &chunk_crcs, data, size, chunk_size](const std::size_t chunk)
+      {
+        const std::size_t offset = chunk * chunk_size;
+
+        std::vector<std::uint64_t> registers = crc_sum_initial_registers(algorithms);
+
+        crc_sum_update(algorithms, registers, data + offset, (std::min)(chunk_size, std::size_t(size - offset)));
+
+        chunk_crcs[chunk] = crc_sum_finalize(algorithms, registers);
+      };
+
+    std::vector<std::thread> threads;
+
+    for(std::size_t chunk = 0U; chunk < (chunk_count - 1U); ++chunk)
+    {
+      threads.emplace_back(crc_sum_chunk, chunk);
+    }
+
+    // The calling thread computes the last of the chunks itself.
+    crc_sum_chunk(chunk_count - 1U);
+
+    for(std::thread& next_thread : threads)
+    {
+      next_thread.join();
+    }
+
+    std::vector<std::uint64_t> crcs = chunk_crcs[0U];
+
+    for(std::size_t chunk = 1U; chunk < chunk_count; ++chunk)
+    {
+      const std::size_t length = (std::min)(chunk_size, std::size_t(size - (chunk * chunk_size)));
+
+      for(std::size_t index = 0U; index < algorithms.size(); ++index)
+      {
+        crcs[index] = algorithms[index]->combine(crcs[index], chunk_crcs[chunk][index], length);
+      }
+    }
+
+    return crcs;
+  }
+
+  // The CRCs of a file read through the pipeline of crc_file_checksum,
+  // either a stream or (where supported) a file descriptor. Returns false
+  // and sets errno on a read error.
+  template<typename FileType>
+  bool crc_sum_read(const crc_sum_algorithms& algorithms, FileType file, std::vector<std::uint64_t>& crcs, std::uint64_t& size)
+  {
+    crcs.resize(algorithms.size());
+
+    return crc::catalog::crc_file_checksum(file, algorithms.data(), algorithms.size(), crcs.data(), &size);
+  }
+
+  // The CRCs of a file. Returns false and sets errno on failure.
+  bool crc_sum_file(const crc_sum_options& options, const std::string& file_name, std::vector<std::uint64_t>& crcs, std::uint64_t& size)
+  {
+    if(file_name == "-")
+    {
+      return crc_sum_read(options.algorithms, stdin, crcs, size);
+    }
+
+    #if defined(CRC_SUM_HAS_MMAP)
+    const int file_descriptor = ::open(file_name.c_str(), O_RDONLY);
+
+    if(file_descriptor < 0)
+    {
+      return false;
+    }
+
+    struct stat file_status;
+
+    if(   options.map_files
+       && (::fstat(file_descriptor, &file_status) == 0) && S_ISREG(file_status.st_mode) && (file_status.st_size > 0))
+    {
+      size = std::uint64_t(file_status.st_size);
+
+      void* mapping = ::mmap(nullptr, std::size_t(size), PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+
+      if(mapping != MAP_FAILED)
+      {
+        ::madvise(mapping, std::size_t(size), MADV_SEQUENTIAL);
+
+        crcs = crc_sum_buffer(options.algorithms, static_cast<const std::uint8_t*>(mapping), std::size_t(size), options.thread_count);
+
+        ::munmap(mapping, std::size_t(size));
+        ::close(file_descriptor);
+
+        return true;
+      }
+    }
+
+    // Read anything that can not be mapped (such as an empty file or a device).
+    const bool read_is_ok = crc_sum_read(options.algorithms, file_descriptor, crcs, size);
+
+    const int read_error = errno;
+
+    ::close(file_descriptor);
+
+    errno = read_error;
+
+    return read_is_ok;
+    #else
+    std::FILE* stream = std::fopen(file_name.c_str(), "rb");
+
+    if(stream == nullptr)
+    {
+      return false;
+    }
+
+    const bool read_is_ok = crc_sum_read(options.algorithms, stream, crcs, size);
+
+    const int read_error = errno;
+
+    std::fclose(stream);
+
+    errno = read_error;
+
+    return read_is_ok;
+    #endif
+  }
+
+  void crc_sum_print(const crc_sum_options& options, const std::string& file_name, const std::vector<std::uint64_t>& crcs, const std::uint64_t size)
+  {
+    for(std::size_t index = 0U; index < options.algorithms.size(); ++index)
+    {
+      const crc::catalog::crc_algorithm& algorithm = *options.algorithms[index];
+
+      std::ostringstream crc_text;
+
+      if(options.format == crc_sum_format::cksum)
+      {
+        crc_text << crcs[index];
+      }
+      else
+      {
+        crc_text << std::hex << std::setfill('0') << std::setw(int((algorithm.number_of_bits + 3U) / 4U)) << crcs[index];
+      }
+
+      if(options.format == crc_sum_format::gnu)
+      {
+        std::cout << crc_text.str() << "  " << file_name << '\n';
+      }
+      else if(options.format == crc_sum_format::bsd)
+      {
+        std::cout << algorithm.name << " (" << file_name << ") = " << crc_text.str() << '\n';
+      }
+      else
+      {
+        std::cout << crc_text.str() << ' ' << size << ((file_name == "-") ? "" : " " + file_name) << '\n';
+      }
+    }
+  }
+
+  bool crc_sum_parse(int argc, char* argv[], crc_sum_options& options)
+  {
+    for(int arg_index = 1; arg_index < argc; ++arg_index)
+    {
+      std::string argument(argv[arg_index]);
+
+      // Accept both "-a NAME" and "--algorithm=NAME" (and likewise for the others).
+      std::string key   = argument;
+      std::string value;
+
+      const std::string::size_type equals_position = argument.find('=');
+
+      if((argument.compare(0U, 2U, "--") == 0) && (equals_position != std::string::npos))
+      {
+        key   = argument.substr(0U, equals_position);
+        value = argument.substr(equals_position + 1U);
+      }
+      else if(   ((argument == "-a") || (argument == "-t") || (argument == "-f"))
+              && ((arg_index + 1) < argc))
+      {
+        value = argv[++arg_index];
+      }
+
+      if((key == "-a") || (key == "--algorithm"))
+      {
+        std::istringstream names(value);
+
+        for(std::string name; std::getline(names, name, ','); )
+        {
+          const crc::catalog::crc_algorithm* algorithm = crc::catalog::crc_find_algorithm(name.c_str());
+
+          if(algorithm == nullptr)
+          {
+            std::cerr << "crcsum: unknown algorithm: " << name << " (see --list)" << std::endl;
+
+            return false;
+          }
+
+          options.algorithms.push_back(algorithm);
+        }
+      }
+      else if((key == "-t") || (key == "--threads"))
+      {
+        options.thread_count = unsigned(std::strtoul(value.c_str(), nullptr, 10));
+      }
+      else if(((key == "-f") || (key == "--format")) && ((value == "gnu") || (value == "bsd") || (value == "cksum")))
+      {
+        options.format = ((value == "gnu") ? crc_sum_format::gnu : ((value == "bsd") ? crc_sum_format::bsd : crc_sum_format::cksum));
+      }
+      else if((key == "-l") || (key == "--list"))
+      {
+        for(std::size_t index = 0U; index < crc::catalog::crc_algorithm_count; ++index)
+        {
+          const crc::catalog::crc_algorithm& algorithm = crc::catalog::crc_algorithms()[index];
+
+          std::cout << std::left << std::setw(24) << algorithm.name << algorithm.identifier << '\n';
+        }
+
+        std::exit(0);
+      }
+      else if(key == "--no-mmap")
+      {
+        options.map_files = false;
+      }
+      else if((key == "-") || (key.empty() == false && key[0U] != '-'))
+      {
+        options.files.push_back(argument);
+      }
+      else
+      {
+        std::cerr << "crcsum: invalid option: " << argument << std::endl;
+
+        return false;
+      }
+    }
+
+    if(options.algorithms.empty())
+    {
+      options.algorithms.push_back(&crc::catalog::crc_find_algorithm(crc::catalog::crc_algorithm_id::crc32));
+    }
+
+    if(options.thread_count == 0U)
+    {
+      options.thread_count = (std::max)(1U, std::thread::hardware_concurrency());
+    }
+
+    if(options.files.empty())
+    {
+      options.files.push_back("-");
+    }
+
+    return true;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  crc_sum_options options;
+
+  if(crc_sum_parse(argc, argv, options) == false)
+  {
+    return 2;
+  }
+
+  int exit_code = 0;
+
+  for(const std::string& file_name : options.files)
+  {
+    std::vector<std::uint64_t> crcs;
+    std::uint64_t              size = 0U;
+
+    errno = 0;
+
+    if(crc_sum_file(options, file_name, crcs, size))
+    {
+      crc_sum_print(options, file_name, crcs, size);
+    }
+    else
+    {
+      std::cout << std::flush;
+
+      std::cerr << "crcsum: " << file_name << ": " << std::strerror((errno != 0) ? errno : EIO) << std::endl;
+
+      exit_code = 1;
+    }
+  }
+
+  return exit_code;
+}